@@ -0,0 +1,142 @@
+/*******************************************************************************
+* File Name        : cy_host.h
+*
+* Description      : Host runtime behind the stand-in PDL. It models the two
+*                    CPUs as threads, keeps the modeled SoC state and provides
+*                    the trace used to check power sequencing on a workstation.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef CY_HOST_H
+#define CY_HOST_H
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_CORE_CM33              (0U)
+#define HOST_CORE_CM55              (1U)
+#define HOST_CORE_COUNT             (2U)
+
+/* SRAM0 and SRAM1 of the CM33, each of 64-KB macros */
+#define HOST_SRAM_COUNT             (2U)
+#define HOST_SRAM_MACROS            (8U)
+#define HOST_SRAM_MACRO_KB          (64U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef enum
+{
+    HOST_CPU_OFF,
+    HOST_CPU_ACTIVE,
+    HOST_CPU_SLEEP,
+    HOST_CPU_DEEP_SLEEP
+} host_cpu_state_t;
+
+/* Modeled state of the SoC as changed through the stand-in PDL calls */
+typedef struct
+{
+    uint32_t syspm_status;                      /* CY_SYSPM_STATUS_SYSTEM_x  */
+    cy_en_syspm_deep_sleep_mode_t deep_sleep_mode;
+    cy_en_rram_vmode_t rram_vmode;
+    bool socmem_enabled;
+    bool cm55_enabled;
+    bool pll_enabled;
+    uint32_t pll_freq_hz;
+    bool hf_enabled[SRSS_NUM_HFROOT];
+    uint32_t hf_divider[SRSS_NUM_HFROOT];       /* Divide by (value + 1)     */
+    uint32_t hf_path[SRSS_NUM_HFROOT];
+    uint32_t peri_slaves_off;                   /* Bit n: group 1 slave n    */
+    uint32_t sram_macros_on[HOST_SRAM_COUNT];   /* Bit n: SRAM macro n       */
+    uint32_t socmem_partitions_off;             /* Bit n: SOCMEM partition n */
+    uint32_t violations;                        /* Illegal sequences found   */
+    uint32_t cpu_sleep_count[HOST_CORE_COUNT];
+    uint32_t cpu_deep_sleep_count[HOST_CORE_COUNT];
+    host_cpu_state_t cpu_state[HOST_CORE_COUNT];
+    bool hibernated;
+    uint32_t hib_wakeup_sources;                /* CY_SYSPM_HIBERNATE_x      */
+    uint32_t reset_reason;                      /* CY_SYSLIB_RESET_x         */
+    bool wdt_enabled;
+    uint32_t wdt_match;
+} host_soc_t;
+
+typedef int (*host_core_entry_t)(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern host_soc_t host_soc;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/* Application entry points of the two core images */
+int cm33_app_main(void);
+int cm55_app_main(void);
+
+void host_init(void);
+void host_set_reset_argv(char *argv[]);
+void host_start_core(uint32_t core, host_core_entry_t entry);
+uint32_t host_current_core(void);
+const char *host_core_name(uint32_t core);
+uint64_t host_time_us(void);
+void host_trace(const char *format, ...)
+    __attribute__((format(printf, 1, 2)));
+
+void host_lock(void);
+void host_unlock(void);
+
+void host_wait_for_interrupt(void);
+void host_raise_interrupt(uint32_t core);
+
+void host_request_stop(const char *reason);
+bool host_wait_stop(uint32_t timeout_ms);
+void host_print_summary(void);
+bool host_write_gpio_timeline(const char *path);
+
+/* Power state model (cy_power_model.c): host_power_event() is called after
+ * every change of the modeled state, without the state locked, and
+ * host_power_pass_to_reset() before the runner starts again for a Hibernate
+ * wakeup reset */
+void host_power_init(void);
+void host_power_event(void);
+void host_power_violation(const char *reason);
+bool host_power_load_currents(const char *path);
+void host_power_print_summary(void);
+void host_power_pass_to_reset(void);
+
+#endif /* CY_HOST_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,548 @@
+/*******************************************************************************
+* File Name        : cy_pdl.h
+*
+* Description      : Host stand-in for the subset of the Peripheral Driver
+*                    Library (PDL) used by this application. The declarations
+*                    mirror the PDL names so that the CM33 and CM55 sources
+*                    build unchanged on a workstation.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************************
+* Compiler and CMSIS-Core
+*******************************************************************************/
+#define __STATIC_INLINE             static inline
+#define CY_SECTION(name)            __attribute__((section(name)))
+#define CY_UNUSED_PARAMETER(x)      ((void)(x))
+#define __CLZ(x)                    ((uint8_t)__builtin_clz(x))
+#define __DMB()                     __sync_synchronize()
+
+/* A core that spins on shared memory lets the other core thread run */
+#define __NOP()                     host_yield()
+
+#define CY_ASSERT(x)                do { if (!(x)) { \
+                                        host_assert_failed(__FILE__, __LINE__); \
+                                    } } while (false)
+
+#define CY_GET_REG32(addr)          (*(volatile uint32_t *)(addr))
+#define CY_SET_REG32(addr, value)   ((void)(addr), (void)(value))
+
+void __enable_irq(void);
+void __disable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void host_assert_failed(const char *file, int line);
+void host_yield(void);
+
+/*******************************************************************************
+* Interrupts
+*******************************************************************************/
+typedef enum
+{
+    srss_interrupt_mcwdt_0_IRQn     = 0,
+    srss_interrupt_mcwdt_1_IRQn     = 1,
+    HOST_IRQ_COUNT                  = 2
+} IRQn_Type;
+
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    IRQn_Type intrSrc;
+    uint32_t  intrPriority;
+} cy_stc_sysint_t;
+
+typedef enum
+{
+    CY_SYSINT_SUCCESS               = 0x0U,
+    CY_SYSINT_BAD_PARAM             = 0x1U
+} cy_en_sysint_status_t;
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config,
+                                     cy_israddress userIsr);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+
+/*******************************************************************************
+* Result codes
+*******************************************************************************/
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS             ((cy_rslt_t)0x00000000U)
+
+/*******************************************************************************
+* Device memory map
+*******************************************************************************/
+typedef struct { uint32_t reserved; } MXCM55_Type;
+typedef struct { uint32_t reserved; } RRAMC_Type;
+
+/* Backup registers, which keep their content through Hibernate */
+typedef struct { volatile uint32_t BREG[32]; } BACKUP_Type;
+
+extern MXCM55_Type host_mxcm55;
+extern RRAMC_Type  host_rramc0;
+extern BACKUP_Type host_backup;
+
+#define MXCM55                          (&host_mxcm55)
+#define RRAMC0                          (&host_rramc0)
+#define BACKUP                          (&host_backup)
+
+#define CYMEM_CM33_0_m55_nvm_C_START    (0x12300000U)
+
+/* Memory shared by the CPUs; the images reach it through the host runtime */
+#define HOST_SHARED_SRAM_SIZE           (0x4000U)
+
+extern uint8_t host_shared_sram[HOST_SHARED_SRAM_SIZE];
+
+#define CYMEM_CM33_0_m33_m55_shared_START  ((uintptr_t)host_shared_sram)
+
+/* Addresses of SRAM0 and SOCMEM on the device; no host object is there */
+#define CY_SRAM0_BASE                   (0x24000000UL)
+#define CY_SOCMEM_RAM_BASE              (0x26000000UL)
+#define CYBSP_MCUBOOT_HEADER_SIZE       (0x400U)
+
+/* SRSS power registers are plain variables on the host */
+extern volatile uint32_t host_srss_pwr_ctl2;
+extern volatile uint32_t host_srss_pwr_hibernate;
+
+#define SRSS_PWR_CTL2                   (host_srss_pwr_ctl2)
+#define SRSS_PWR_HIBERNATE              (host_srss_pwr_hibernate)
+#define SRSS_PWR_CTL2_BGREF_LPMODE_Msk  (0x00100000U)
+
+/*******************************************************************************
+* SysLib
+*******************************************************************************/
+void Cy_SysLib_Delay(uint32_t milliseconds);
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+void Cy_SysEnableCM55(MXCM55_Type *base, uint32_t vectorTableOffset,
+                      uint32_t waitus);
+void Cy_SysDisableCM55(MXCM55_Type *base);
+void Cy_SysEnableSOCMEM(bool enable);
+
+#define CY_SYSLIB_RESET_HIB_WAKEUP      (0x40000UL)
+
+uint32_t Cy_SysLib_GetResetReason(void);
+void Cy_SysLib_ClearResetReason(void);
+
+/*******************************************************************************
+* SysClk
+*******************************************************************************/
+typedef enum
+{
+    CY_SYSCLK_SUCCESS               = 0x00U,
+    CY_SYSCLK_BAD_PARAM             = 0x01U,
+    CY_SYSCLK_TIMEOUT               = 0x02U,
+    CY_SYSCLK_INVALID_STATE         = 0x03U,
+    CY_SYSCLK_UNSUPPORTED_STATE     = 0xFFU
+} cy_en_sysclk_status_t;
+
+typedef enum
+{
+    CY_SYSCLK_FLLPLL_OUTPUT_AUTO    = 0U,
+    CY_SYSCLK_FLLPLL_OUTPUT_AUTO1   = 1U,
+    CY_SYSCLK_FLLPLL_OUTPUT_INPUT   = 2U,
+    CY_SYSCLK_FLLPLL_OUTPUT_OUTPUT  = 3U
+} cy_en_fll_pll_output_mode_t;
+
+typedef struct
+{
+    uint32_t                    inputFreq;
+    uint32_t                    outputFreq;
+    bool                        lfMode;
+    cy_en_fll_pll_output_mode_t outputMode;
+} cy_stc_pll_config_t;
+
+/* Register-level DPLL-LP settings; the loop gain fields are not modeled */
+typedef struct
+{
+    uint8_t                     feedbackDiv;
+    uint8_t                     referenceDiv;
+    uint8_t                     outputDiv;
+    bool                        pllDcoMode;
+    cy_en_fll_pll_output_mode_t outputMode;
+    uint32_t                    fracDiv;
+    bool                        fracDitherEn;
+    bool                        fracEn;
+} cy_stc_dpll_lp_config_t;
+
+typedef struct
+{
+    cy_stc_dpll_lp_config_t     *lpPllCfg;
+} cy_stc_pll_manual_config_t;
+
+typedef enum
+{
+    CY_SYSCLK_CLKHF_NO_DIVIDE       = 0U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_2     = 1U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_3     = 2U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_4     = 3U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_5     = 4U
+} cy_en_clkhf_dividers_t;
+
+typedef enum
+{
+    CY_SYSCLK_CLKHF_IN_CLKPATH0     = 0U,
+    CY_SYSCLK_CLKHF_IN_CLKPATH1     = 1U
+} cy_en_clkhf_in_sources_t;
+
+/* Clock path 0 runs straight from the IHO, path 1 is the DPLL-LP */
+#define CY_SYSCLK_IHO_FREQ_HZ           (50000000U)
+#define SRSS_NUM_CLKPATH                (2U)
+#define SRSS_NUM_HFROOT                 (14U)
+#define SRSS_DPLL_LP_0_PATH_NUM         (1U)
+
+#define CY_CFG_SYSCLK_CLKHF0            (0U)
+#define CY_CFG_SYSCLK_CLKHF1            (1U)
+#define CY_CFG_SYSCLK_CLKHF2            (2U)
+#define CY_CFG_SYSCLK_CLKHF3            (3U)
+#define CY_CFG_SYSCLK_CLKHF4            (4U)
+#define CY_CFG_SYSCLK_CLKHF5            (5U)
+#define CY_CFG_SYSCLK_CLKHF6            (6U)
+#define CY_CFG_SYSCLK_CLKHF7            (7U)
+#define CY_CFG_SYSCLK_CLKHF9            (9U)
+#define CY_CFG_SYSCLK_CLKHF10           (10U)
+#define CY_CFG_SYSCLK_CLKHF11           (11U)
+#define CY_CFG_SYSCLK_CLKHF12           (12U)
+#define CY_CFG_SYSCLK_CLKHF13           (13U)
+
+void Cy_SysClk_PllDisable(uint32_t clkPath);
+cy_en_sysclk_status_t Cy_SysClk_PllConfigure(uint32_t clkPath,
+                                             const cy_stc_pll_config_t *config);
+cy_en_sysclk_status_t Cy_SysClk_PllManualConfigure(uint32_t clkPath,
+                                   const cy_stc_pll_manual_config_t *config);
+cy_en_sysclk_status_t Cy_SysClk_PllGetConfiguration(uint32_t clkPath,
+                                   cy_stc_pll_manual_config_t *config);
+cy_en_sysclk_status_t Cy_SysClk_PllEnable(uint32_t clkPath,
+                                          uint32_t timeoutus);
+bool Cy_SysClk_PllIsEnabled(uint32_t clkPath);
+bool Cy_SysClk_PllLocked(uint32_t clkPath);
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfEnable(uint32_t clkHf);
+cy_en_sysclk_status_t Cy_SysClk_ClkHfDisable(uint32_t clkHf);
+bool Cy_SysClk_ClkHfIsEnabled(uint32_t clkHf);
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetSource(uint32_t clkHf,
+                                               cy_en_clkhf_in_sources_t source);
+cy_en_clkhf_in_sources_t Cy_SysClk_ClkHfGetSource(uint32_t clkHf);
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf,
+                                                cy_en_clkhf_dividers_t divider);
+uint32_t Cy_SysClk_ClkHfGetFrequency(uint32_t clkHf);
+
+typedef enum
+{
+    CY_SYSCLK_PERI_GROUP_SL_CTL     = 0U,
+    CY_SYSCLK_PERI_GROUP_SL_CTL2    = 1U,
+    CY_SYSCLK_PERI_GROUP_SL_CTL3    = 2U
+} cy_en_peri_grp_sl_ctl_num_t;
+
+void Cy_SysClk_PeriGroupSlaveDeinit(uint32_t periNum, uint32_t groupNum,
+                                    uint32_t slaveNum);
+bool Cy_SysClk_IsPeriGroupSlaveCtlSet(uint32_t groupNum,
+                                      cy_en_peri_grp_sl_ctl_num_t slaveCtl,
+                                      uint32_t slaveNum);
+
+/*******************************************************************************
+* SysPm
+*******************************************************************************/
+typedef enum
+{
+    CY_SYSPM_SUCCESS                = 0x0U,
+    CY_SYSPM_BAD_PARAM              = 0x1U,
+    CY_SYSPM_TIMEOUT                = 0x2U,
+    CY_SYSPM_INVALID_STATE          = 0x3U,
+    CY_SYSPM_CANCELED               = 0x4U,
+    CY_SYSPM_SYSCALL_PENDING        = 0x5U,
+    CY_SYSPM_FAIL                   = 0xFU
+} cy_en_syspm_status_t;
+
+typedef enum
+{
+    CY_SYSPM_WAIT_FOR_INTERRUPT     = 0U,
+    CY_SYSPM_WAIT_FOR_EVENT         = 1U
+} cy_en_syspm_waitfor_t;
+
+typedef enum
+{
+    CY_SYSPM_MODE_DEEPSLEEP         = 0U,
+    CY_SYSPM_MODE_DEEPSLEEP_RAM     = 1U,
+    CY_SYSPM_MODE_DEEPSLEEP_OFF     = 2U,
+    CY_SYSPM_MODE_DEEPSLEEP_NONE    = 3U
+} cy_en_syspm_deep_sleep_mode_t;
+
+/* Older alias used by the CM55 project */
+#define CY_SYSPM_DEEPSLEEP_OFF          (CY_SYSPM_MODE_DEEPSLEEP_OFF)
+
+#define CY_SYSPM_STATUS_SYSTEM_HP       (0x0010U)
+#define CY_SYSPM_STATUS_SYSTEM_LP       (0x0020U)
+#define CY_SYSPM_STATUS_SYSTEM_ULP      (0x0040U)
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHp(void);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterLp(void);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterUlp(void);
+uint32_t Cy_SysPm_ReadStatus(void);
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor);
+cy_en_syspm_status_t Cy_SysPm_CpuEnterDeepSleep(cy_en_syspm_waitfor_t waitFor);
+void Cy_SysPm_SystemEnterHibernate(void);
+cy_en_syspm_status_t Cy_SysPm_SetDeepSleepMode(
+                                    cy_en_syspm_deep_sleep_mode_t deepSleepMode);
+cy_en_syspm_deep_sleep_mode_t Cy_SysPm_GetDeepSleepMode(void);
+
+typedef enum
+{
+    CY_SYSPM_SRAM0_MEMORY           = 0U,
+    CY_SYSPM_SRAM1_MEMORY           = 1U
+} cy_en_syspm_sram_index_t;
+
+typedef enum
+{
+    CY_SYSPM_SRAM_PWR_MODE_OFF      = 0U,
+    CY_SYSPM_SRAM_PWR_MODE_RET      = 2U,
+    CY_SYSPM_SRAM_PWR_MODE_ON       = 3U
+} cy_en_syspm_sram_pwr_mode_t;
+
+cy_en_syspm_status_t Cy_SysPm_SetSRAMMacroPwrMode(
+                                    cy_en_syspm_sram_index_t sramNum,
+                                    uint32_t sramMacroNum,
+                                    cy_en_syspm_sram_pwr_mode_t sramPwrMode);
+
+typedef enum
+{
+    CY_SYSPM_SOCMEM_SRAM_ACTIVE_MODE = 0U,
+    CY_SYSPM_SOCMEM_SRAM_DS_MODE    = 1U
+} cy_en_syspm_socmem_sram_op_mode_t;
+
+typedef enum
+{
+    CY_SYSPM_SOCMEM_SRAM_ON         = 0U,
+    CY_SYSPM_SOCMEM_SRAM_OFF        = 1U,
+    CY_SYSPM_SOCMEM_SRAM_RET        = 2U
+} cy_en_syspm_socmem_sram_pwr_mode_t;
+
+cy_en_syspm_status_t Cy_SysPm_SetSOCMEMSramPartitionPwrMode(
+                                    uint32_t partitionNum,
+                                    cy_en_syspm_socmem_sram_op_mode_t opMode,
+                                    cy_en_syspm_socmem_sram_pwr_mode_t pwrMode);
+
+#define CY_SYSPM_HIBERNATE_WDT          (0x00010000UL)
+
+void Cy_SysPm_SetHibernateWakeupSource(uint32_t wakeupSource);
+
+/*******************************************************************************
+* RRAM
+*******************************************************************************/
+typedef enum
+{
+    CY_RRAM_VMODE_HP                = 0U,
+    CY_RRAM_VMODE_LP                = 1U,
+    CY_RRAM_VMODE_ULP               = 2U
+} cy_en_rram_vmode_t;
+
+void Cy_RRAM_SetVoltageMode(RRAMC_Type *base, cy_en_rram_vmode_t vmode);
+
+/*******************************************************************************
+* Watchdog timer (WDT)
+*******************************************************************************/
+/* The 16-bit counter counts CLK_LF (HOST_CLK_LF_HZ) through Hibernate and the
+ * wakeup reset; a match wakes the system from Hibernate */
+void Cy_WDT_Enable(void);
+void Cy_WDT_Disable(void);
+void Cy_WDT_Lock(void);
+void Cy_WDT_Unlock(void);
+void Cy_WDT_SetMatch(uint32_t match);
+uint32_t Cy_WDT_GetCount(void);
+void Cy_WDT_ClearInterrupt(void);
+void Cy_WDT_UnmaskInterrupt(void);
+
+/*******************************************************************************
+* Multi-counter watchdog timer (MCWDT)
+*******************************************************************************/
+typedef struct { uint32_t reserved; } MCWDT_STRUCT_Type;
+
+#define HOST_MCWDT_COUNT                (2U)
+
+extern MCWDT_STRUCT_Type host_mcwdt[HOST_MCWDT_COUNT];
+
+#define MCWDT_STRUCT0                   (&host_mcwdt[0])
+#define MCWDT_STRUCT1                   (&host_mcwdt[1])
+
+#define CY_MCWDT_CTR0                   (0x1UL)
+#define CY_MCWDT_CTR1                   (0x2UL)
+#define CY_MCWDT_CTR2                   (0x4UL)
+
+#define CY_MCWDT_MODE_NONE              (0U)
+#define CY_MCWDT_MODE_INT               (1U)
+#define CY_MCWDT_MODE_RESET             (2U)
+#define CY_MCWDT_MODE_INT_RESET         (3U)
+
+typedef enum
+{
+    CY_MCWDT_SUCCESS                = 0x00U,
+    CY_MCWDT_BAD_PARAM              = 0x01U
+} cy_en_mcwdt_status_t;
+
+typedef struct
+{
+    uint16_t c0Match;
+    uint16_t c1Match;
+    uint32_t c0Mode;
+    uint32_t c1Mode;
+    uint32_t c2ToggleBit;
+    uint32_t c2Mode;
+    bool     c0ClearOnMatch;
+    bool     c1ClearOnMatch;
+    bool     c0c1Cascade;
+    bool     c1c2Cascade;
+} cy_stc_mcwdt_config_t;
+
+/* Counter 0 is modeled; it counts CLK_LF at this rate */
+#define HOST_CLK_LF_HZ                  (32768U)
+
+cy_en_mcwdt_status_t Cy_MCWDT_Init(MCWDT_STRUCT_Type *base,
+                                   cy_stc_mcwdt_config_t const *config);
+void Cy_MCWDT_Enable(MCWDT_STRUCT_Type *base, uint32_t counters,
+                     uint16_t waitUs);
+void Cy_MCWDT_Disable(MCWDT_STRUCT_Type *base, uint32_t counters,
+                      uint16_t waitUs);
+void Cy_MCWDT_ClearInterrupt(MCWDT_STRUCT_Type *base, uint32_t counters);
+void Cy_MCWDT_SetInterruptMask(MCWDT_STRUCT_Type *base, uint32_t counters);
+
+/*******************************************************************************
+* Inter-processor communication (IPC)
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t DATA0;
+} IPC_STRUCT_Type;
+
+#define HOST_IPC_CHANNELS               (16U)
+
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex);
+void Cy_IPC_Drv_WriteDataValue(IPC_STRUCT_Type *base, uint32_t dataValue);
+uint32_t Cy_IPC_Drv_ReadDataValue(IPC_STRUCT_Type const *base);
+
+/*******************************************************************************
+* GPIO
+*******************************************************************************/
+typedef struct
+{
+    volatile uint32_t OUT;
+} GPIO_PRT_Type;
+
+#define HOST_GPIO_PORTS                 (22U)
+
+extern GPIO_PRT_Type host_gpio[HOST_GPIO_PORTS];
+
+#define GPIO_PRT0                       (&host_gpio[0])
+
+#define CY_GPIO_DM_STRONG_IN_OFF        (0x06UL)
+
+typedef enum
+{
+    HSIOM_SEL_GPIO                  = 0U
+} en_hsiom_sel_t;
+
+void Cy_GPIO_Pin_FastInit(GPIO_PRT_Type *base, uint32_t pinNum,
+                          uint32_t driveMode, uint32_t outVal,
+                          en_hsiom_sel_t hsiom);
+void Cy_GPIO_Write(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value);
+void Cy_GPIO_Set(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_Clr(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_Inv(GPIO_PRT_Type *base, uint32_t pinNum);
+
+/*******************************************************************************
+* Power policy units (PPU) and power dependency control matrix (PDCM)
+*******************************************************************************/
+struct ppu_v1_reg
+{
+    volatile uint32_t PWPR;
+    volatile uint32_t PMER;
+    volatile uint32_t PWSR;
+};
+
+enum ppu_v1_mode
+{
+    PPU_V1_MODE_OFF                 = 0,
+    PPU_V1_MODE_OFF_EMU             = 1,
+    PPU_V1_MODE_MEM_RET             = 2,
+    PPU_V1_MODE_MEM_RET_EMU         = 3,
+    PPU_V1_MODE_LOGIC_RET           = 4,
+    PPU_V1_MODE_FULL_RET            = 5,
+    PPU_V1_MODE_MEM_OFF             = 6,
+    PPU_V1_MODE_FUNC_RET            = 7,
+    PPU_V1_MODE_ON                  = 8,
+    PPU_V1_MODE_WARM_RST            = 9,
+    PPU_V1_MODE_DBG_RECOV           = 10
+};
+
+/* Indexes of the PPUs modeled by the host */
+#define HOST_PPU_PD1                    (0U)
+#define HOST_PPU_SOCMEM                 (1U)
+#define HOST_PPU_APPCPUSS               (2U)
+#define HOST_PPU_APPCPU                 (3U)
+#define HOST_PPU_COUNT                  (4U)
+
+extern struct ppu_v1_reg host_ppu[HOST_PPU_COUNT];
+
+#define CY_PPU_PD1_BASE                 (&host_ppu[HOST_PPU_PD1])
+#define CY_PPU_SOCMEM_BASE              (&host_ppu[HOST_PPU_SOCMEM])
+#define CY_PPU_APPCPUSS_BASE            (&host_ppu[HOST_PPU_APPCPUSS])
+#define CY_PPU_APPCPU_BASE              (&host_ppu[HOST_PPU_APPCPU])
+
+typedef enum
+{
+    CY_PD_PDCM_MAIN                 = 0U,
+    CY_PD_PDCM_SYSCPU               = 1U,
+    CY_PD_PDCM_PD1                  = 2U,
+    CY_PD_PDCM_SOCMEM               = 3U,
+    CY_PD_PDCM_APPCPUSS             = 4U,
+    CY_PD_PDCM_APPCPU               = 5U
+} cy_pd_pdcm_id_t;
+
+cy_en_syspm_status_t cy_pd_ppu_set_power_mode(struct ppu_v1_reg *ppu,
+                                              uint32_t mode);
+uint32_t cy_pd_ppu_get_power_mode(struct ppu_v1_reg *ppu);
+cy_en_syspm_status_t cy_pd_pdcm_set_dependency(cy_pd_pdcm_id_t host_pd,
+                                               cy_pd_pdcm_id_t dest_pd);
+cy_en_syspm_status_t cy_pd_pdcm_clear_dependency(cy_pd_pdcm_id_t host_pd,
+                                                 cy_pd_pdcm_id_t dest_pd);
+
+#endif /* CY_PDL_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,1688 @@
+/*******************************************************************************
+* File Name        : cy_pdl_host.c
+*
+* Description      : Host implementation of the stand-in PDL. Every call
+*                    updates the modeled SoC state in host_soc and is written
+*                    to the trace, so that the power sequencing of the CM33
+*                    and CM55 applications can be checked on a workstation.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "cy_host.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PLL_MIN_OUTPUT_FREQ_HZ      (25000000U)
+#define PLL_MAX_OUTPUT_FREQ_HZ      (400000000U)
+#define PLL_DEFAULT_FREQ_HZ         (400000000U)
+
+/* Modeled time from the DPLL-LP enable to its lock; until then the path
+ * outputs the IHO reference */
+#define PLL_LOCK_TIME_US            (20U)
+
+/* DPLL-LP register limits: comparison and DCO frequencies and dividers */
+#define PLL_MIN_PFD_FREQ_HZ         (4000000U)
+#define PLL_MAX_PFD_FREQ_HZ         (8000000U)
+#define PLL_MIN_DCO_FREQ_HZ         (400000000U)
+#define PLL_MAX_DCO_FREQ_HZ         (800000000U)
+#define PLL_MIN_FEEDBACK_DIV        (16U)
+#define PLL_MAX_FEEDBACK_DIV        (200U)
+#define PLL_MAX_REFERENCE_DIV       (16U)
+#define PLL_MAX_OUTPUT_DIV          (16U)
+#define PLL_FRAC_BITS               (24U)
+#define PERI_GROUP_MODELED          (1U)
+#define PERI_PD1_INSTANCE           (1U)      /* PERI1, in PD1 */
+#define PDCM_COUNT                  (CY_PD_PDCM_APPCPU + 1U)
+
+/* The backup registers reach the runner started by a Hibernate wakeup reset
+ * in this environment variable */
+#define BACKUP_ENV                  "POWER_HOST_BACKUP"
+#define WDT_COUNTER_MASK            (0xFFFFUL)
+#define BACKUP_WORDS                (sizeof(host_backup.BREG) / \
+                                     sizeof(host_backup.BREG[0]))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+host_soc_t host_soc;
+MXCM55_Type host_mxcm55;
+RRAMC_Type host_rramc0;
+BACKUP_Type host_backup;
+volatile uint32_t host_srss_pwr_ctl2;
+volatile uint32_t host_srss_pwr_hibernate;
+struct ppu_v1_reg host_ppu[HOST_PPU_COUNT];
+uint8_t host_shared_sram[HOST_SHARED_SRAM_SIZE] __attribute__((aligned(64)));
+
+static const char *const ppu_names[HOST_PPU_COUNT] =
+{
+    "PD1", "SOCMEM", "APPCPUSS", "APPCPU"
+};
+
+/* Domain each PPU domain is part of; it must be on while the domain is on */
+static const uint32_t ppu_parent[HOST_PPU_COUNT] =
+{
+    HOST_PPU_COUNT, HOST_PPU_PD1, HOST_PPU_PD1, HOST_PPU_APPCPUSS
+};
+
+/* CLK_HF dividers as set by the device configurator (design.modus) */
+static const uint32_t hf_default_divider[SRSS_NUM_HFROOT] =
+{
+    1U, 0U, 1U, 1U, 0U, 1U, 1U, 0U, 0U, 4U, 3U, 1U, 0U, 3U
+};
+
+static pthread_mutex_t state_mutex = PTHREAD_MUTEX_INITIALIZER;
+static __thread int state_cancel_state;
+static pthread_mutex_t event_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t event_cond = PTHREAD_COND_INITIALIZER;
+static __thread int event_cancel_state;
+static bool irq_pending[HOST_CORE_COUNT];
+static bool core_reset[HOST_CORE_COUNT];
+static bool stop_requested;
+static const char *stop_reason = "run time elapsed";
+static pthread_t core_thread[HOST_CORE_COUNT];
+static bool core_started[HOST_CORE_COUNT];
+static __thread uint32_t current_core = HOST_CORE_CM33;
+static struct timespec start_time;
+static char **reset_argv;
+static uint32_t pll_config_freq_hz;
+static uint64_t pll_lock_time_us;
+
+/* DPLL-LP registers as set by the device configurator: 50 MHz / 10 * 80 */
+static cy_stc_dpll_lp_config_t pll_registers =
+{
+    80U, 10U, 1U, false, CY_SYSCLK_FLLPLL_OUTPUT_AUTO, 0U, false, false
+};
+static bool pdcm_dependency[PDCM_COUNT][PDCM_COUNT];
+
+/* Interrupt controller: one handler and owning core per modeled IRQ */
+static cy_israddress irq_handler[HOST_IRQ_COUNT];
+static uint32_t irq_owner[HOST_IRQ_COUNT];
+static bool irq_enabled[HOST_IRQ_COUNT];
+
+/* MCWDT counter 0 of each instance, advanced by a ticker thread */
+typedef struct
+{
+    uint32_t match;
+    bool enabled;
+    uint32_t intr_mask;
+    uint32_t generation;
+    bool ticker_started;
+    pthread_t ticker;
+} host_mcwdt_state_t;
+
+MCWDT_STRUCT_Type host_mcwdt[HOST_MCWDT_COUNT];
+static host_mcwdt_state_t mcwdt_state[HOST_MCWDT_COUNT];
+static pthread_mutex_t mcwdt_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mcwdt_cond = PTHREAD_COND_INITIALIZER;
+
+static IPC_STRUCT_Type host_ipc[HOST_IPC_CHANNELS];
+
+/* Output changes of the GPIO pins, in the order they happened. A pin keeps
+ * at most GPIO_PIN_EDGE_LIMIT of them, so that pins toggled on every
+ * Dhrystone iteration leave room for the phase markers. */
+#define GPIO_TIMELINE_LENGTH        (262144U)
+#define GPIO_PIN_EDGE_LIMIT         (GPIO_TIMELINE_LENGTH / 8U)
+
+typedef struct
+{
+    uint64_t time_us;
+    uint8_t core;
+    uint8_t port;
+    uint8_t pin;
+    uint8_t level;
+} host_gpio_edge_t;
+
+GPIO_PRT_Type host_gpio[HOST_GPIO_PORTS];
+static host_gpio_edge_t gpio_timeline[GPIO_TIMELINE_LENGTH];
+static uint32_t gpio_edges;
+static uint32_t gpio_pin_edges[HOST_GPIO_PORTS][8];
+static uint32_t gpio_edges_dropped;
+
+/*******************************************************************************
+* Host runtime
+*******************************************************************************/
+typedef struct
+{
+    uint32_t core;
+    host_core_entry_t entry;
+} core_start_t;
+
+static void *core_thread_main(void *arg)
+{
+    core_start_t start = *(core_start_t *)arg;
+
+    free(arg);
+    current_core = start.core;
+
+    /* Cy_SysDisableCM55() cancels the thread wherever the core is running */
+    (void)pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
+    (void)start.entry();
+    host_trace("main() returned");
+
+    return NULL;
+}
+
+void host_init(void)
+{
+    char *backup;
+    uint32_t hf;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    memset(&host_soc, 0, sizeof(host_soc));
+    host_soc.syspm_status = CY_SYSPM_STATUS_SYSTEM_HP;
+    host_soc.deep_sleep_mode = CY_SYSPM_MODE_DEEPSLEEP;
+    for (hf = 0U; hf < HOST_SRAM_COUNT; hf++)
+    {
+        host_soc.sram_macros_on[hf] = (1UL << HOST_SRAM_MACROS) - 1U;
+    }
+    host_soc.rram_vmode = CY_RRAM_VMODE_HP;
+    host_soc.socmem_enabled = true;
+    host_soc.pll_enabled = true;
+    host_soc.pll_freq_hz = PLL_DEFAULT_FREQ_HZ;
+    pll_config_freq_hz = PLL_DEFAULT_FREQ_HZ;
+
+    for (hf = 0U; hf < SRSS_NUM_HFROOT; hf++)
+    {
+        host_soc.hf_enabled[hf] = (8U != hf);
+        host_soc.hf_divider[hf] = hf_default_divider[hf];
+        host_soc.hf_path[hf] = SRSS_DPLL_LP_0_PATH_NUM;
+    }
+
+    for (hf = 0U; hf < HOST_PPU_COUNT; hf++)
+    {
+        host_ppu[hf].PWSR = (uint32_t)PPU_V1_MODE_ON;
+    }
+
+    /* APPCPUSS is kept on while the SYSCPU is on (reset default) */
+    pdcm_dependency[CY_PD_PDCM_APPCPUSS][CY_PD_PDCM_SYSCPU] = true;
+
+    host_soc.cpu_state[HOST_CORE_CM33] = HOST_CPU_ACTIVE;
+    host_soc.cpu_state[HOST_CORE_CM55] = HOST_CPU_OFF;
+    host_power_init();
+
+    /* Started by a Hibernate wakeup reset: the backup registers survived */
+    backup = getenv(BACKUP_ENV);
+    if (NULL != backup)
+    {
+        for (hf = 0U; (hf < BACKUP_WORDS) && ('\0' != *backup); hf++)
+        {
+            host_backup.BREG[hf] = (uint32_t)strtoul(backup, &backup, 16);
+            backup += (',' == *backup) ? 1 : 0;
+        }
+        host_soc.reset_reason = CY_SYSLIB_RESET_HIB_WAKEUP;
+        (void)unsetenv(BACKUP_ENV);
+        host_trace("hibernate wakeup reset");
+    }
+}
+
+void host_set_reset_argv(char *argv[])
+{
+    reset_argv = argv;
+}
+
+void host_start_core(uint32_t core, host_core_entry_t entry)
+{
+    core_start_t *start;
+
+    if (core_started[core])
+    {
+        return;
+    }
+
+    start = malloc(sizeof(*start));
+    CY_ASSERT(NULL != start);
+    start->core = core;
+    start->entry = entry;
+    core_started[core] = true;
+
+    if (0 != pthread_create(&core_thread[core], NULL, core_thread_main, start))
+    {
+        host_assert_failed(__FILE__, __LINE__);
+    }
+}
+
+uint32_t host_current_core(void)
+{
+    return current_core;
+}
+
+const char *host_core_name(uint32_t core)
+{
+    return (HOST_CORE_CM33 == core) ? "cm33" : "cm55";
+}
+
+uint64_t host_time_us(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)(now.tv_sec - start_time.tv_sec) * 1000000U) +
+           (uint64_t)((now.tv_nsec - start_time.tv_nsec) / 1000);
+}
+
+void host_trace(const char *format, ...)
+{
+    va_list args;
+    uint64_t now_us = host_time_us();
+
+    host_lock();
+    (void)printf("[%5u.%03u ms] %s: ", (unsigned)(now_us / 1000U),
+                 (unsigned)(now_us % 1000U), host_core_name(current_core));
+    va_start(args, format);
+    (void)vprintf(format, args);
+    va_end(args);
+    (void)printf("\n");
+    host_unlock();
+}
+
+/* A core thread is never cancelled while it holds one of the mutexes */
+void host_lock(void)
+{
+    (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state_cancel_state);
+    (void)pthread_mutex_lock(&state_mutex);
+}
+
+void host_unlock(void)
+{
+    (void)pthread_mutex_unlock(&state_mutex);
+    (void)pthread_setcancelstate(state_cancel_state, NULL);
+}
+
+static void event_lock(void)
+{
+    (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &event_cancel_state);
+    (void)pthread_mutex_lock(&event_mutex);
+}
+
+static void event_unlock(void)
+{
+    (void)pthread_mutex_unlock(&event_mutex);
+    (void)pthread_setcancelstate(event_cancel_state, NULL);
+}
+
+void host_yield(void)
+{
+    (void)sched_yield();
+}
+
+void host_wait_for_interrupt(void)
+{
+    event_lock();
+    while (!irq_pending[current_core] && !core_reset[current_core])
+    {
+        (void)pthread_cond_wait(&event_cond, &event_mutex);
+    }
+    irq_pending[current_core] = false;
+    event_unlock();
+
+    /* Acts on a pending reset of this core */
+    pthread_testcancel();
+}
+
+void host_raise_interrupt(uint32_t core)
+{
+    event_lock();
+    irq_pending[core] = true;
+    (void)pthread_cond_broadcast(&event_cond);
+    event_unlock();
+}
+
+void host_request_stop(const char *reason)
+{
+    event_lock();
+    if (!stop_requested)
+    {
+        stop_requested = true;
+        stop_reason = reason;
+    }
+    (void)pthread_cond_broadcast(&event_cond);
+    event_unlock();
+}
+
+bool host_wait_stop(uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    bool stopped;
+
+    (void)clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(timeout_ms / 1000U);
+    deadline.tv_nsec += (long)(timeout_ms % 1000U) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    event_lock();
+    while (!stop_requested)
+    {
+        if (0 != pthread_cond_timedwait(&event_cond, &event_mutex, &deadline))
+        {
+            break;
+        }
+    }
+    stopped = stop_requested;
+    event_unlock();
+
+    return stopped;
+}
+
+void host_print_summary(void)
+{
+    static const char *const rram_names[] = { "HP", "LP", "ULP" };
+    const char *mode = "HP";
+    uint32_t index;
+
+    if (0U != (host_soc.syspm_status & CY_SYSPM_STATUS_SYSTEM_ULP))
+    {
+        mode = "ULP";
+    }
+    else if (0U != (host_soc.syspm_status & CY_SYSPM_STATUS_SYSTEM_LP))
+    {
+        mode = "LP";
+    }
+
+    host_lock();
+    (void)printf("--- SoC state (%s) ---\n", stop_reason);
+    (void)printf("system power mode : %s%s\n", mode,
+                 host_soc.hibernated ? " (hibernate)" : "");
+    (void)printf("deepsleep mode    : %s\n",
+                 (CY_SYSPM_MODE_DEEPSLEEP_OFF == host_soc.deep_sleep_mode) ?
+                 "DEEPSLEEP_OFF" : "DEEPSLEEP");
+    (void)printf("sram macros on    : 0x%02x / 0x%02x\n",
+                 (unsigned)host_soc.sram_macros_on[0],
+                 (unsigned)host_soc.sram_macros_on[1]);
+    (void)printf("socmem parts off  : 0x%03x\n",
+                 (unsigned)host_soc.socmem_partitions_off);
+    (void)printf("rram voltage mode : %s\n", rram_names[host_soc.rram_vmode]);
+    (void)printf("dpll-lp           : %s, %u Hz\n",
+                 host_soc.pll_enabled ? "on" : "off",
+                 (unsigned)host_soc.pll_freq_hz);
+    (void)printf("clk_hf on         :");
+    for (index = 0U; index < SRSS_NUM_HFROOT; index++)
+    {
+        if (host_soc.hf_enabled[index])
+        {
+            (void)printf(" %u", (unsigned)index);
+        }
+    }
+    (void)printf("\n");
+    host_unlock();
+
+    (void)printf("clk_hf0 / clk_hf1 : %u Hz / %u Hz\n",
+                 (unsigned)Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0),
+                 (unsigned)Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF1));
+
+    host_lock();
+    (void)printf("socmem / cm55     : %s / %s\n",
+                 host_soc.socmem_enabled ? "enabled" : "disabled",
+                 host_soc.cm55_enabled ? "enabled" : "disabled");
+    for (index = 0U; index < HOST_PPU_COUNT; index++)
+    {
+        (void)printf("ppu %-13s : %s\n", ppu_names[index],
+                     (PPU_V1_MODE_OFF == host_ppu[index].PWSR) ? "OFF" : "ON");
+    }
+    for (index = 0U; index < HOST_CORE_COUNT; index++)
+    {
+        (void)printf("%s sleep/deep   : %u / %u\n", host_core_name(index),
+                     (unsigned)host_soc.cpu_sleep_count[index],
+                     (unsigned)host_soc.cpu_deep_sleep_count[index]);
+    }
+    (void)printf("gpio edges        : %u (%u dropped)\n", (unsigned)gpio_edges,
+                 (unsigned)gpio_edges_dropped);
+    host_unlock();
+
+    host_power_print_summary();
+}
+
+bool host_write_gpio_timeline(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    uint32_t index;
+
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    host_lock();
+    (void)fprintf(file, "time_us,core,port,pin,level\n");
+    for (index = 0U; index < gpio_edges; index++)
+    {
+        (void)fprintf(file, "%llu,%s,%u,%u,%u\n",
+                      (unsigned long long)gpio_timeline[index].time_us,
+                      host_core_name(gpio_timeline[index].core),
+                      (unsigned)gpio_timeline[index].port,
+                      (unsigned)gpio_timeline[index].pin,
+                      (unsigned)gpio_timeline[index].level);
+    }
+    host_unlock();
+
+    return (0 == fclose(file));
+}
+
+void host_assert_failed(const char *file, int line)
+{
+    host_trace("CY_ASSERT failed at %s:%d", file, line);
+    (void)fflush(stdout);
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* CMSIS-Core
+*******************************************************************************/
+void __enable_irq(void)
+{
+}
+
+void __disable_irq(void)
+{
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return 0U;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+    CY_UNUSED_PARAMETER(priMask);
+}
+
+/*******************************************************************************
+* BSP
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    host_trace("cybsp_init");
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* SysLib
+*******************************************************************************/
+void Cy_SysLib_Delay(uint32_t milliseconds)
+{
+    struct timespec delay;
+
+    delay.tv_sec = (time_t)(milliseconds / 1000U);
+    delay.tv_nsec = (long)(milliseconds % 1000U) * 1000000L;
+    (void)nanosleep(&delay, NULL);
+}
+
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    struct timespec delay;
+
+    delay.tv_sec = 0;
+    delay.tv_nsec = (long)microseconds * 1000L;
+    (void)nanosleep(&delay, NULL);
+}
+
+void Cy_SysEnableCM55(MXCM55_Type *base, uint32_t vectorTableOffset,
+                      uint32_t waitus)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(waitus);
+    bool unpowered;
+
+    host_trace("Cy_SysEnableCM55(0x%08x)", (unsigned)vectorTableOffset);
+    host_lock();
+    unpowered = (PPU_V1_MODE_OFF == host_ppu[HOST_PPU_APPCPU].PWSR);
+    host_soc.cm55_enabled = true;
+    host_soc.cpu_state[HOST_CORE_CM55] = HOST_CPU_ACTIVE;
+    host_unlock();
+
+    if (unpowered)
+    {
+        host_power_violation("CM55 enabled with APPCPU off");
+    }
+    host_power_event();
+    host_start_core(HOST_CORE_CM55, cm55_app_main);
+}
+
+void Cy_SysDisableCM55(MXCM55_Type *base)
+{
+    CY_UNUSED_PARAMETER(base);
+
+    host_trace("Cy_SysDisableCM55");
+    if (core_started[HOST_CORE_CM55])
+    {
+        /* Hold the core in reset: stop its thread wherever it runs. The
+         * cancel is pending before the core is woken so that it does not
+         * run on past host_wait_for_interrupt() */
+        (void)pthread_cancel(core_thread[HOST_CORE_CM55]);
+        event_lock();
+        core_reset[HOST_CORE_CM55] = true;
+        (void)pthread_cond_broadcast(&event_cond);
+        event_unlock();
+
+        (void)pthread_join(core_thread[HOST_CORE_CM55], NULL);
+
+        event_lock();
+        core_reset[HOST_CORE_CM55] = false;
+        irq_pending[HOST_CORE_CM55] = false;
+        event_unlock();
+        core_started[HOST_CORE_CM55] = false;
+    }
+
+    host_lock();
+    host_soc.cm55_enabled = false;
+    host_soc.cpu_state[HOST_CORE_CM55] = HOST_CPU_OFF;
+    host_unlock();
+    host_power_event();
+}
+
+void Cy_SysEnableSOCMEM(bool enable)
+{
+    host_trace("Cy_SysEnableSOCMEM(%s)", enable ? "true" : "false");
+    host_lock();
+    host_soc.socmem_enabled = enable;
+    host_unlock();
+}
+
+uint32_t Cy_SysLib_GetResetReason(void)
+{
+    uint32_t reason;
+
+    host_lock();
+    reason = host_soc.reset_reason;
+    host_unlock();
+
+    return reason;
+}
+
+void Cy_SysLib_ClearResetReason(void)
+{
+    host_lock();
+    host_soc.reset_reason = 0U;
+    host_unlock();
+}
+
+/*******************************************************************************
+* Interrupts
+*******************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config,
+                                     cy_israddress userIsr)
+{
+    if ((NULL == config) || ((uint32_t)config->intrSrc >= HOST_IRQ_COUNT))
+    {
+        return CY_SYSINT_BAD_PARAM;
+    }
+
+    host_lock();
+    irq_handler[config->intrSrc] = userIsr;
+    irq_owner[config->intrSrc] = current_core;
+    host_unlock();
+
+    return CY_SYSINT_SUCCESS;
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    host_lock();
+    irq_enabled[IRQn] = true;
+    host_unlock();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    host_lock();
+    irq_enabled[IRQn] = false;
+    host_unlock();
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    CY_UNUSED_PARAMETER(IRQn);
+}
+
+/* Runs the handler on the calling thread as the owning core, then wakes it */
+static void irq_dispatch(IRQn_Type IRQn)
+{
+    cy_israddress handler;
+    uint32_t owner;
+    bool enabled;
+
+    host_lock();
+    handler = irq_handler[IRQn];
+    owner = irq_owner[IRQn];
+    enabled = irq_enabled[IRQn];
+    host_unlock();
+
+    if (enabled && (NULL != handler))
+    {
+        current_core = owner;
+        handler();
+        host_raise_interrupt(owner);
+    }
+}
+
+/*******************************************************************************
+* MCWDT
+*******************************************************************************/
+static void *mcwdt_ticker_main(void *arg)
+{
+    uint32_t index = (uint32_t)(uintptr_t)arg;
+    host_mcwdt_state_t *mcwdt = &mcwdt_state[index];
+
+    (void)pthread_mutex_lock(&mcwdt_mutex);
+    for (;;)
+    {
+        struct timespec deadline;
+        uint64_t period_ns;
+        uint32_t generation;
+        bool deliver;
+
+        while (!mcwdt->enabled)
+        {
+            (void)pthread_cond_wait(&mcwdt_cond, &mcwdt_mutex);
+        }
+
+        generation = mcwdt->generation;
+        period_ns = ((uint64_t)mcwdt->match + 1U) * 1000000000U /
+                    HOST_CLK_LF_HZ;
+        (void)clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += (time_t)(period_ns / 1000000000U);
+        deadline.tv_nsec += (long)(period_ns % 1000000000U);
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        while (mcwdt->enabled && (generation == mcwdt->generation))
+        {
+            if (0 != pthread_cond_timedwait(&mcwdt_cond, &mcwdt_mutex,
+                                            &deadline))
+            {
+                break;
+            }
+        }
+
+        if (!mcwdt->enabled || (generation != mcwdt->generation))
+        {
+            continue;
+        }
+
+        deliver = (0U != (mcwdt->intr_mask & CY_MCWDT_CTR0));
+        (void)pthread_mutex_unlock(&mcwdt_mutex);
+        if (deliver)
+        {
+            irq_dispatch((0U == index) ? srss_interrupt_mcwdt_0_IRQn :
+                                         srss_interrupt_mcwdt_1_IRQn);
+        }
+        (void)pthread_mutex_lock(&mcwdt_mutex);
+    }
+
+    return NULL;
+}
+
+static host_mcwdt_state_t *mcwdt_get(MCWDT_STRUCT_Type *base)
+{
+    uint32_t index = (uint32_t)(base - host_mcwdt);
+
+    CY_ASSERT(index < HOST_MCWDT_COUNT);
+
+    return &mcwdt_state[index];
+}
+
+cy_en_mcwdt_status_t Cy_MCWDT_Init(MCWDT_STRUCT_Type *base,
+                                   cy_stc_mcwdt_config_t const *config)
+{
+    host_mcwdt_state_t *mcwdt = mcwdt_get(base);
+
+    if (NULL == config)
+    {
+        return CY_MCWDT_BAD_PARAM;
+    }
+
+    host_trace("Cy_MCWDT_Init(%u, match %u)",
+               (unsigned)(base - host_mcwdt), (unsigned)config->c0Match);
+    (void)pthread_mutex_lock(&mcwdt_mutex);
+    mcwdt->match = config->c0Match;
+    (void)pthread_mutex_unlock(&mcwdt_mutex);
+
+    return CY_MCWDT_SUCCESS;
+}
+
+void Cy_MCWDT_Enable(MCWDT_STRUCT_Type *base, uint32_t counters,
+                     uint16_t waitUs)
+{
+    host_mcwdt_state_t *mcwdt = mcwdt_get(base);
+
+    CY_UNUSED_PARAMETER(waitUs);
+
+    if (0U == (counters & CY_MCWDT_CTR0))
+    {
+        return;
+    }
+
+    (void)pthread_mutex_lock(&mcwdt_mutex);
+    mcwdt->enabled = true;
+    mcwdt->generation++;
+    if (!mcwdt->ticker_started)
+    {
+        mcwdt->ticker_started = true;
+        if (0 != pthread_create(&mcwdt->ticker, NULL, mcwdt_ticker_main,
+                                (void *)(uintptr_t)(mcwdt - mcwdt_state)))
+        {
+            host_assert_failed(__FILE__, __LINE__);
+        }
+        (void)pthread_detach(mcwdt->ticker);
+    }
+    (void)pthread_cond_broadcast(&mcwdt_cond);
+    (void)pthread_mutex_unlock(&mcwdt_mutex);
+}
+
+void Cy_MCWDT_Disable(MCWDT_STRUCT_Type *base, uint32_t counters,
+                      uint16_t waitUs)
+{
+    host_mcwdt_state_t *mcwdt = mcwdt_get(base);
+
+    CY_UNUSED_PARAMETER(waitUs);
+
+    if (0U == (counters & CY_MCWDT_CTR0))
+    {
+        return;
+    }
+
+    (void)pthread_mutex_lock(&mcwdt_mutex);
+    mcwdt->enabled = false;
+    mcwdt->generation++;
+    (void)pthread_cond_broadcast(&mcwdt_cond);
+    (void)pthread_mutex_unlock(&mcwdt_mutex);
+}
+
+void Cy_MCWDT_ClearInterrupt(MCWDT_STRUCT_Type *base, uint32_t counters)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(counters);
+}
+
+void Cy_MCWDT_SetInterruptMask(MCWDT_STRUCT_Type *base, uint32_t counters)
+{
+    host_mcwdt_state_t *mcwdt = mcwdt_get(base);
+
+    (void)pthread_mutex_lock(&mcwdt_mutex);
+    mcwdt->intr_mask = counters;
+    (void)pthread_mutex_unlock(&mcwdt_mutex);
+}
+
+/*******************************************************************************
+* WDT
+*******************************************************************************/
+void Cy_WDT_Enable(void)
+{
+    host_trace("Cy_WDT_Enable");
+    host_lock();
+    host_soc.wdt_enabled = true;
+    host_unlock();
+}
+
+void Cy_WDT_Disable(void)
+{
+    host_trace("Cy_WDT_Disable");
+    host_lock();
+    host_soc.wdt_enabled = false;
+    host_unlock();
+}
+
+void Cy_WDT_Lock(void)
+{
+}
+
+void Cy_WDT_Unlock(void)
+{
+}
+
+void Cy_WDT_SetMatch(uint32_t match)
+{
+    host_trace("Cy_WDT_SetMatch(%u)", (unsigned)match);
+    host_lock();
+    host_soc.wdt_match = match & WDT_COUNTER_MASK;
+    host_unlock();
+}
+
+/* The counter runs from CLOCK_MONOTONIC, which a wakeup reset does not
+ * restart */
+uint32_t Cy_WDT_GetCount(void)
+{
+    struct timespec now;
+    uint64_t ns;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    ns = ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+
+    return (uint32_t)((ns * HOST_CLK_LF_HZ) / 1000000000U) & WDT_COUNTER_MASK;
+}
+
+void Cy_WDT_ClearInterrupt(void)
+{
+}
+
+void Cy_WDT_UnmaskInterrupt(void)
+{
+}
+
+/*******************************************************************************
+* IPC
+*******************************************************************************/
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex)
+{
+    CY_ASSERT(ipcIndex < HOST_IPC_CHANNELS);
+
+    return &host_ipc[ipcIndex];
+}
+
+void Cy_IPC_Drv_WriteDataValue(IPC_STRUCT_Type *base, uint32_t dataValue)
+{
+    host_trace("Cy_IPC_Drv_WriteDataValue(%u, 0x%08x)",
+               (unsigned)(base - host_ipc), (unsigned)dataValue);
+    base->DATA0 = dataValue;
+}
+
+uint32_t Cy_IPC_Drv_ReadDataValue(IPC_STRUCT_Type const *base)
+{
+    return base->DATA0;
+}
+
+/*******************************************************************************
+* GPIO
+*******************************************************************************/
+static void gpio_output(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    uint32_t port = (uint32_t)(base - host_gpio);
+    uint32_t mask = 1UL << pinNum;
+    uint32_t level = (0U != value) ? 1U : 0U;
+
+    CY_ASSERT((port < HOST_GPIO_PORTS) && (pinNum < 8U));
+
+    host_lock();
+    if (((base->OUT & mask) != 0U) != (1U == level))
+    {
+        base->OUT ^= mask;
+        if ((gpio_edges < GPIO_TIMELINE_LENGTH) &&
+            (gpio_pin_edges[port][pinNum] < GPIO_PIN_EDGE_LIMIT))
+        {
+            gpio_pin_edges[port][pinNum]++;
+            gpio_timeline[gpio_edges].time_us = host_time_us();
+            gpio_timeline[gpio_edges].core = (uint8_t)current_core;
+            gpio_timeline[gpio_edges].port = (uint8_t)port;
+            gpio_timeline[gpio_edges].pin = (uint8_t)pinNum;
+            gpio_timeline[gpio_edges].level = (uint8_t)level;
+            gpio_edges++;
+        }
+        else
+        {
+            gpio_edges_dropped++;
+        }
+    }
+    host_unlock();
+}
+
+void Cy_GPIO_Pin_FastInit(GPIO_PRT_Type *base, uint32_t pinNum,
+                          uint32_t driveMode, uint32_t outVal,
+                          en_hsiom_sel_t hsiom)
+{
+    host_trace("Cy_GPIO_Pin_FastInit(P%u.%u, %u)",
+               (unsigned)(base - host_gpio), (unsigned)pinNum,
+               (unsigned)outVal);
+    CY_UNUSED_PARAMETER(driveMode);
+    CY_UNUSED_PARAMETER(hsiom);
+    gpio_output(base, pinNum, outVal);
+}
+
+void Cy_GPIO_Write(GPIO_PRT_Type *base, uint32_t pinNum, uint32_t value)
+{
+    gpio_output(base, pinNum, value);
+}
+
+void Cy_GPIO_Set(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    gpio_output(base, pinNum, 1U);
+}
+
+void Cy_GPIO_Clr(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    gpio_output(base, pinNum, 0U);
+}
+
+void Cy_GPIO_Inv(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    gpio_output(base, pinNum, ((base->OUT >> pinNum) & 1U) ^ 1U);
+}
+
+/*******************************************************************************
+* SysClk
+*******************************************************************************/
+void Cy_SysClk_PllDisable(uint32_t clkPath)
+{
+    CY_ASSERT(SRSS_DPLL_LP_0_PATH_NUM == clkPath);
+
+    host_trace("Cy_SysClk_PllDisable(%u)", (unsigned)clkPath);
+    host_lock();
+    host_soc.pll_enabled = false;
+    host_unlock();
+    host_power_event();
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PllConfigure(uint32_t clkPath,
+                                             const cy_stc_pll_config_t *config)
+{
+    cy_en_sysclk_status_t status = CY_SYSCLK_SUCCESS;
+
+    host_trace("Cy_SysClk_PllConfigure(%u, %u Hz -> %u Hz)", (unsigned)clkPath,
+               (unsigned)config->inputFreq, (unsigned)config->outputFreq);
+
+    host_lock();
+    if ((SRSS_DPLL_LP_0_PATH_NUM != clkPath) ||
+        (config->outputFreq < PLL_MIN_OUTPUT_FREQ_HZ) ||
+        (config->outputFreq > PLL_MAX_OUTPUT_FREQ_HZ))
+    {
+        status = CY_SYSCLK_BAD_PARAM;
+    }
+    else if (host_soc.pll_enabled)
+    {
+        /* The PLL must be disabled before it is reconfigured */
+        status = CY_SYSCLK_INVALID_STATE;
+    }
+    else
+    {
+        pll_config_freq_hz = config->outputFreq;
+    }
+    host_unlock();
+
+    return status;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PllManualConfigure(uint32_t clkPath,
+                                   const cy_stc_pll_manual_config_t *config)
+{
+    const cy_stc_dpll_lp_config_t *lp = config->lpPllCfg;
+    cy_en_sysclk_status_t status = CY_SYSCLK_SUCCESS;
+    uint64_t feedback;
+    uint64_t pfd_hz;
+    uint64_t dco_hz;
+
+    if ((SRSS_DPLL_LP_0_PATH_NUM != clkPath) || (NULL == lp) ||
+        (0U == lp->referenceDiv) || (0U == lp->outputDiv))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    feedback = ((uint64_t)lp->feedbackDiv << PLL_FRAC_BITS) +
+               (lp->fracEn ? lp->fracDiv : 0U);
+    pfd_hz = CY_SYSCLK_IHO_FREQ_HZ / lp->referenceDiv;
+    dco_hz = ((uint64_t)CY_SYSCLK_IHO_FREQ_HZ * feedback) /
+             ((uint64_t)lp->referenceDiv << PLL_FRAC_BITS);
+
+    host_trace("Cy_SysClk_PllManualConfigure(%u, P %u + %u/2^24, Q %u, "
+               "out %u -> %u Hz)", (unsigned)clkPath,
+               (unsigned)lp->feedbackDiv, (unsigned)lp->fracDiv,
+               (unsigned)lp->referenceDiv, (unsigned)lp->outputDiv,
+               (unsigned)(dco_hz / lp->outputDiv));
+
+    host_lock();
+    if ((lp->feedbackDiv < PLL_MIN_FEEDBACK_DIV) ||
+        (lp->feedbackDiv > PLL_MAX_FEEDBACK_DIV) ||
+        (lp->referenceDiv > PLL_MAX_REFERENCE_DIV) ||
+        (lp->outputDiv > PLL_MAX_OUTPUT_DIV) ||
+        (pfd_hz < PLL_MIN_PFD_FREQ_HZ) || (pfd_hz > PLL_MAX_PFD_FREQ_HZ) ||
+        (dco_hz < PLL_MIN_DCO_FREQ_HZ) || (dco_hz > PLL_MAX_DCO_FREQ_HZ) ||
+        ((dco_hz / lp->outputDiv) > PLL_MAX_OUTPUT_FREQ_HZ))
+    {
+        status = CY_SYSCLK_BAD_PARAM;
+    }
+    else if (host_soc.pll_enabled)
+    {
+        /* The PLL must be disabled before it is reconfigured */
+        status = CY_SYSCLK_INVALID_STATE;
+    }
+    else
+    {
+        pll_registers = *lp;
+        pll_config_freq_hz = (uint32_t)(dco_hz / lp->outputDiv);
+    }
+    host_unlock();
+
+    return status;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PllGetConfiguration(uint32_t clkPath,
+                                   cy_stc_pll_manual_config_t *config)
+{
+    if ((SRSS_DPLL_LP_0_PATH_NUM != clkPath) || (NULL == config->lpPllCfg))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    host_lock();
+    *config->lpPllCfg = pll_registers;
+    host_unlock();
+
+    return CY_SYSCLK_SUCCESS;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_PllEnable(uint32_t clkPath,
+                                          uint32_t timeoutus)
+{
+    cy_en_sysclk_status_t status = CY_SYSCLK_SUCCESS;
+    uint64_t deadline_us;
+
+    if (SRSS_DPLL_LP_0_PATH_NUM != clkPath)
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    host_trace("Cy_SysClk_PllEnable(%u)", (unsigned)clkPath);
+    host_lock();
+    host_soc.pll_enabled = true;
+    host_soc.pll_freq_hz = pll_config_freq_hz;
+    pll_lock_time_us = host_time_us() + PLL_LOCK_TIME_US;
+    host_unlock();
+
+    /* Waits for the lock for at most timeoutus */
+    deadline_us = host_time_us() + timeoutus;
+    while (!Cy_SysClk_PllLocked(clkPath))
+    {
+        if (host_time_us() >= deadline_us)
+        {
+            status = CY_SYSCLK_TIMEOUT;
+            break;
+        }
+        Cy_SysLib_DelayUs(1U);
+    }
+    host_power_event();
+
+    return status;
+}
+
+bool Cy_SysClk_PllLocked(uint32_t clkPath)
+{
+    bool locked;
+
+    host_lock();
+    locked = (SRSS_DPLL_LP_0_PATH_NUM == clkPath) && host_soc.pll_enabled &&
+             (host_time_us() >= pll_lock_time_us);
+    host_unlock();
+
+    return locked;
+}
+
+bool Cy_SysClk_PllIsEnabled(uint32_t clkPath)
+{
+    bool enabled;
+
+    host_lock();
+    enabled = (SRSS_DPLL_LP_0_PATH_NUM == clkPath) && host_soc.pll_enabled;
+    host_unlock();
+
+    return enabled;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfEnable(uint32_t clkHf)
+{
+    if (clkHf >= SRSS_NUM_HFROOT)
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    host_trace("Cy_SysClk_ClkHfEnable(%u)", (unsigned)clkHf);
+    host_lock();
+    host_soc.hf_enabled[clkHf] = true;
+    host_unlock();
+    host_power_event();
+
+    return CY_SYSCLK_SUCCESS;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfDisable(uint32_t clkHf)
+{
+    /* CLK_HF0 clocks the CM33 and cannot be disabled */
+    if ((0U == clkHf) || (clkHf >= SRSS_NUM_HFROOT))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    host_trace("Cy_SysClk_ClkHfDisable(%u)", (unsigned)clkHf);
+    host_lock();
+    host_soc.hf_enabled[clkHf] = false;
+    host_unlock();
+    host_power_event();
+
+    return CY_SYSCLK_SUCCESS;
+}
+
+bool Cy_SysClk_ClkHfIsEnabled(uint32_t clkHf)
+{
+    bool enabled;
+
+    host_lock();
+    enabled = (clkHf < SRSS_NUM_HFROOT) && host_soc.hf_enabled[clkHf];
+    host_unlock();
+
+    return enabled;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf,
+                                                cy_en_clkhf_dividers_t divider)
+{
+    if (clkHf >= SRSS_NUM_HFROOT)
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    host_trace("Cy_SysClk_ClkHfSetDivider(%u, /%u)", (unsigned)clkHf,
+               (unsigned)divider + 1U);
+    host_lock();
+    host_soc.hf_divider[clkHf] = (uint32_t)divider;
+    host_unlock();
+    host_power_event();
+
+    return CY_SYSCLK_SUCCESS;
+}
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetSource(uint32_t clkHf,
+                                               cy_en_clkhf_in_sources_t source)
+{
+    if ((clkHf >= SRSS_NUM_HFROOT) || ((uint32_t)source >= SRSS_NUM_CLKPATH))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+
+    host_trace("Cy_SysClk_ClkHfSetSource(%u, path %u)", (unsigned)clkHf,
+               (unsigned)source);
+    host_lock();
+    host_soc.hf_path[clkHf] = (uint32_t)source;
+    host_unlock();
+    host_power_event();
+
+    return CY_SYSCLK_SUCCESS;
+}
+
+cy_en_clkhf_in_sources_t Cy_SysClk_ClkHfGetSource(uint32_t clkHf)
+{
+    uint32_t path = 0U;
+
+    host_lock();
+    if (clkHf < SRSS_NUM_HFROOT)
+    {
+        path = host_soc.hf_path[clkHf];
+    }
+    host_unlock();
+
+    return (cy_en_clkhf_in_sources_t)path;
+}
+
+uint32_t Cy_SysClk_ClkHfGetFrequency(uint32_t clkHf)
+{
+    uint32_t path_freq = CY_SYSCLK_IHO_FREQ_HZ;
+    uint32_t freq = 0U;
+
+    host_lock();
+    if ((clkHf < SRSS_NUM_HFROOT) && host_soc.hf_enabled[clkHf])
+    {
+        /* A disabled or unlocked DPLL bypasses its IHO reference to the
+         * path output */
+        if ((SRSS_DPLL_LP_0_PATH_NUM == host_soc.hf_path[clkHf]) &&
+            host_soc.pll_enabled && (host_time_us() >= pll_lock_time_us))
+        {
+            path_freq = host_soc.pll_freq_hz;
+        }
+        freq = path_freq / (host_soc.hf_divider[clkHf] + 1U);
+    }
+    host_unlock();
+
+    return freq;
+}
+
+void Cy_SysClk_PeriGroupSlaveDeinit(uint32_t periNum, uint32_t groupNum,
+                                    uint32_t slaveNum)
+{
+    host_trace("Cy_SysClk_PeriGroupSlaveDeinit(%u, %u, %u)", (unsigned)periNum,
+               (unsigned)groupNum, (unsigned)slaveNum);
+    if ((PERI_GROUP_MODELED == groupNum) && (slaveNum < 32U))
+    {
+        host_lock();
+        host_soc.peri_slaves_off |= (1UL << slaveNum);
+        host_unlock();
+    }
+}
+
+/* Only the clock enable bits of SL_CTL are modeled; groupNum carries the PERI
+ * instance in bits 8-15. PERI1 is in PD1 and cannot be read while PD1 is off */
+bool Cy_SysClk_IsPeriGroupSlaveCtlSet(uint32_t groupNum,
+                                      cy_en_peri_grp_sl_ctl_num_t slaveCtl,
+                                      uint32_t slaveNum)
+{
+    bool set = false;
+    bool pd1_off;
+
+    host_lock();
+    pd1_off = (PPU_V1_MODE_OFF == host_ppu[HOST_PPU_PD1].PWSR);
+    host_unlock();
+
+    if ((PERI_PD1_INSTANCE == (groupNum >> 8U)) && pd1_off)
+    {
+        host_power_violation("PERI1 group read with PD1 off");
+        return false;
+    }
+
+    if ((CY_SYSCLK_PERI_GROUP_SL_CTL == slaveCtl) && (slaveNum < 32U))
+    {
+        host_lock();
+        set = ((PERI_GROUP_MODELED != (groupNum & 0xFFU)) ||
+               (0U == (host_soc.peri_slaves_off & (1UL << slaveNum))));
+        host_unlock();
+    }
+
+    return set;
+}
+
+/*******************************************************************************
+* SysPm
+*******************************************************************************/
+static cy_en_syspm_status_t enter_system_mode(uint32_t status, const char *name)
+{
+    host_trace("Cy_SysPm_SystemEnter%s", name);
+    host_lock();
+    host_soc.syspm_status = status;
+    host_unlock();
+    host_power_event();
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHp(void)
+{
+    return enter_system_mode(CY_SYSPM_STATUS_SYSTEM_HP, "Hp");
+}
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterLp(void)
+{
+    return enter_system_mode(CY_SYSPM_STATUS_SYSTEM_LP, "Lp");
+}
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterUlp(void)
+{
+    return enter_system_mode(CY_SYSPM_STATUS_SYSTEM_ULP, "Ulp");
+}
+
+uint32_t Cy_SysPm_ReadStatus(void)
+{
+    uint32_t status;
+
+    host_lock();
+    status = host_soc.syspm_status;
+    host_unlock();
+
+    return status;
+}
+
+static void cpu_enter_state(host_cpu_state_t state)
+{
+    host_lock();
+    host_soc.cpu_state[current_core] = state;
+    host_unlock();
+    host_power_event();
+}
+
+cy_en_syspm_status_t Cy_SysPm_CpuEnterSleep(cy_en_syspm_waitfor_t waitFor)
+{
+    CY_UNUSED_PARAMETER(waitFor);
+
+    cpu_enter_state(HOST_CPU_SLEEP);
+    host_lock();
+    host_soc.cpu_sleep_count[current_core]++;
+    host_unlock();
+    host_wait_for_interrupt();
+    cpu_enter_state(HOST_CPU_ACTIVE);
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t Cy_SysPm_CpuEnterDeepSleep(cy_en_syspm_waitfor_t waitFor)
+{
+    CY_UNUSED_PARAMETER(waitFor);
+
+    cpu_enter_state(HOST_CPU_DEEP_SLEEP);
+    host_lock();
+    host_soc.cpu_deep_sleep_count[current_core]++;
+    host_unlock();
+    host_wait_for_interrupt();
+    cpu_enter_state(HOST_CPU_ACTIVE);
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/* Waits for the WDT match and starts the runner again with the backup
+ * registers, as the wakeup reset of the device would. Returns if it cannot. */
+static void hibernate_wakeup_reset(void)
+{
+    char backup[BACKUP_WORDS * 9U + 1U];
+    struct timespec delay;
+    uint64_t ticks;
+    size_t length = 0U;
+    uint32_t word;
+
+    host_lock();
+    ticks = (host_soc.wdt_match - Cy_WDT_GetCount()) & WDT_COUNTER_MASK;
+    host_unlock();
+    ticks = (0U == ticks) ? (WDT_COUNTER_MASK + 1U) : ticks;
+    delay.tv_sec = (time_t)(ticks / HOST_CLK_LF_HZ);
+    delay.tv_nsec = (long)(((ticks % HOST_CLK_LF_HZ) * 1000000000U) /
+                           HOST_CLK_LF_HZ);
+    (void)nanosleep(&delay, NULL);
+    host_power_pass_to_reset();
+
+    for (word = 0U; word < BACKUP_WORDS; word++)
+    {
+        length += (size_t)snprintf(&backup[length], sizeof(backup) - length,
+                                   "%08x,", (unsigned)host_backup.BREG[word]);
+    }
+    (void)setenv(BACKUP_ENV, backup, 1);
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+    (void)execv("/proc/self/exe", reset_argv);
+    host_trace("cannot start the runner again");
+}
+
+void Cy_SysPm_SetHibernateWakeupSource(uint32_t wakeupSource)
+{
+    host_trace("Cy_SysPm_SetHibernateWakeupSource(0x%x)",
+               (unsigned)wakeupSource);
+    host_lock();
+    host_soc.hib_wakeup_sources |= wakeupSource;
+    host_unlock();
+}
+
+void Cy_SysPm_SystemEnterHibernate(void)
+{
+    bool wdt_wakeup;
+
+    host_trace("Cy_SysPm_SystemEnterHibernate");
+    host_lock();
+    host_soc.hibernated = true;
+    wdt_wakeup = host_soc.wdt_enabled && (NULL != reset_argv) &&
+        (0U != (host_soc.hib_wakeup_sources & CY_SYSPM_HIBERNATE_WDT));
+    host_unlock();
+    host_power_event();
+    if (wdt_wakeup)
+    {
+        hibernate_wakeup_reset();
+    }
+    host_request_stop("hibernate");
+
+    /* Nothing runs until the wakeup reset */
+    for (;;)
+    {
+        host_wait_for_interrupt();
+    }
+}
+
+cy_en_syspm_status_t Cy_SysPm_SetDeepSleepMode(
+                                    cy_en_syspm_deep_sleep_mode_t deepSleepMode)
+{
+    host_trace("Cy_SysPm_SetDeepSleepMode(%u)", (unsigned)deepSleepMode);
+    host_lock();
+    host_soc.deep_sleep_mode = deepSleepMode;
+    host_unlock();
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t Cy_SysPm_SetSRAMMacroPwrMode(
+                                    cy_en_syspm_sram_index_t sramNum,
+                                    uint32_t sramMacroNum,
+                                    cy_en_syspm_sram_pwr_mode_t sramPwrMode)
+{
+    uint32_t *macros_on;
+    uint32_t before;
+    uint32_t after;
+
+    if (((uint32_t)sramNum >= HOST_SRAM_COUNT) ||
+        (sramMacroNum >= HOST_SRAM_MACROS))
+    {
+        return CY_SYSPM_BAD_PARAM;
+    }
+
+    host_lock();
+    macros_on = &host_soc.sram_macros_on[sramNum];
+    before = *macros_on;
+    if (CY_SYSPM_SRAM_PWR_MODE_ON == sramPwrMode)
+    {
+        *macros_on |= 1UL << sramMacroNum;
+    }
+    else
+    {
+        *macros_on &= ~(1UL << sramMacroNum);
+    }
+    after = *macros_on;
+    host_unlock();
+
+    if (before != after)
+    {
+        host_trace("Cy_SysPm_SetSRAMMacroPwrMode(%u, %u, %u)",
+                   (unsigned)sramNum, (unsigned)sramMacroNum,
+                   (unsigned)sramPwrMode);
+        host_power_event();
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t Cy_SysPm_SetSOCMEMSramPartitionPwrMode(
+                                    uint32_t partitionNum,
+                                    cy_en_syspm_socmem_sram_op_mode_t opMode,
+                                    cy_en_syspm_socmem_sram_pwr_mode_t pwrMode)
+{
+    bool socmem_off;
+
+    host_trace("Cy_SysPm_SetSOCMEMSramPartitionPwrMode(%u, %u, %u)",
+               (unsigned)partitionNum, (unsigned)opMode, (unsigned)pwrMode);
+    if (partitionNum >= 32U)
+    {
+        return CY_SYSPM_BAD_PARAM;
+    }
+
+    host_lock();
+    socmem_off = (PPU_V1_MODE_OFF == host_ppu[HOST_PPU_SOCMEM].PWSR);
+    /* Only the active mode setting is modeled */
+    if ((CY_SYSPM_SOCMEM_SRAM_ACTIVE_MODE == opMode) &&
+        (CY_SYSPM_SOCMEM_SRAM_OFF == pwrMode))
+    {
+        host_soc.socmem_partitions_off |= 1UL << partitionNum;
+    }
+    else if (CY_SYSPM_SOCMEM_SRAM_ACTIVE_MODE == opMode)
+    {
+        host_soc.socmem_partitions_off &= ~(1UL << partitionNum);
+    }
+    host_unlock();
+
+    if (socmem_off)
+    {
+        host_power_violation("SOCMEM partition set with SOCMEM off");
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_deep_sleep_mode_t Cy_SysPm_GetDeepSleepMode(void)
+{
+    cy_en_syspm_deep_sleep_mode_t mode;
+
+    host_lock();
+    mode = (cy_en_syspm_deep_sleep_mode_t)host_soc.deep_sleep_mode;
+    host_unlock();
+
+    return mode;
+}
+
+/*******************************************************************************
+* RRAM
+*******************************************************************************/
+void Cy_RRAM_SetVoltageMode(RRAMC_Type *base, cy_en_rram_vmode_t vmode)
+{
+    CY_UNUSED_PARAMETER(base);
+
+    host_trace("Cy_RRAM_SetVoltageMode(%u)", (unsigned)vmode);
+    host_lock();
+    host_soc.rram_vmode = vmode;
+    host_unlock();
+}
+
+/*******************************************************************************
+* PPU and PDCM
+*******************************************************************************/
+/* Returns why a PPU mode change breaks the domain dependencies, or NULL.
+ * Called with the state locked. */
+static const char *ppu_order_violation(uint32_t index, uint32_t mode)
+{
+    uint32_t child;
+
+    if (PPU_V1_MODE_OFF != mode)
+    {
+        if ((HOST_PPU_COUNT != ppu_parent[index]) &&
+            (PPU_V1_MODE_OFF == host_ppu[ppu_parent[index]].PWSR))
+        {
+            return "parent domain is off";
+        }
+        return NULL;
+    }
+
+    for (child = 0U; child < HOST_PPU_COUNT; child++)
+    {
+        if ((index == ppu_parent[child]) &&
+            (PPU_V1_MODE_OFF != host_ppu[child].PWSR))
+        {
+            return "child domain is on";
+        }
+    }
+
+    if ((HOST_PPU_APPCPUSS == index) &&
+        pdcm_dependency[CY_PD_PDCM_APPCPUSS][CY_PD_PDCM_SYSCPU])
+    {
+        return "held on by SYSCPU";
+    }
+
+    return NULL;
+}
+
+cy_en_syspm_status_t cy_pd_ppu_set_power_mode(struct ppu_v1_reg *ppu,
+                                              uint32_t mode)
+{
+    uint32_t index = (uint32_t)(ppu - host_ppu);
+    const char *violation;
+    char text[64];
+
+    if (index >= HOST_PPU_COUNT)
+    {
+        return CY_SYSPM_BAD_PARAM;
+    }
+
+    host_trace("cy_pd_ppu_set_power_mode(%s, %s)", ppu_names[index],
+               (PPU_V1_MODE_OFF == mode) ? "OFF" : "ON");
+    host_lock();
+    violation = ppu_order_violation(index, mode);
+    ppu->PWPR = mode;
+    ppu->PWSR = mode;
+    if ((HOST_PPU_SOCMEM == index) && (PPU_V1_MODE_OFF == mode))
+    {
+        /* The partitions power up with the domain */
+        host_soc.socmem_partitions_off = 0U;
+    }
+    host_unlock();
+
+    if (NULL != violation)
+    {
+        (void)snprintf(text, sizeof(text), "%s %s: %s", ppu_names[index],
+                       (PPU_V1_MODE_OFF == mode) ? "OFF" : "ON", violation);
+        host_power_violation(text);
+    }
+    host_power_event();
+
+    return CY_SYSPM_SUCCESS;
+}
+
+uint32_t cy_pd_ppu_get_power_mode(struct ppu_v1_reg *ppu)
+{
+    uint32_t mode;
+
+    host_lock();
+    mode = ppu->PWSR;
+    host_unlock();
+
+    return mode;
+}
+
+cy_en_syspm_status_t cy_pd_pdcm_set_dependency(cy_pd_pdcm_id_t host_pd,
+                                               cy_pd_pdcm_id_t dest_pd)
+{
+    host_trace("cy_pd_pdcm_set_dependency(%u, %u)", (unsigned)host_pd,
+               (unsigned)dest_pd);
+    host_lock();
+    pdcm_dependency[host_pd][dest_pd] = true;
+    host_unlock();
+
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t cy_pd_pdcm_clear_dependency(cy_pd_pdcm_id_t host_pd,
+                                                 cy_pd_pdcm_id_t dest_pd)
+{
+    host_trace("cy_pd_pdcm_clear_dependency(%u, %u)", (unsigned)host_pd,
+               (unsigned)dest_pd);
+    host_lock();
+    pdcm_dependency[host_pd][dest_pd] = false;
+    host_unlock();
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,519 @@
+/*******************************************************************************
+* File Name        : cy_power_model.c
+*
+* Description      : Power state model of the host runtime. After every
+*                    change of the modeled SoC state it checks the system
+*                    power mode against the clocks and the power domains,
+*                    and integrates an estimate of the supply current from
+*                    the current of the SPEC ID that matches the state.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cy_host.h"
+#include "specs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MODE_HP                     (0U)
+#define MODE_LP                     (1U)
+#define MODE_ULP                    (2U)
+#define MODE_COUNT                  (3U)
+
+#define SPEC_ID_COUNT               (SIDDSA + 1U)
+
+/* Name of the retention current of an SRAM macro in a currents file */
+#define SRAM_MACRO_NAME             "SRAM64K"
+
+/* Sources of the currents. The built-in values are estimates; the datasheet
+ * tables they stand in for are named so that they can be replaced. */
+#define SOURCE_ACTIVE               "estimate, datasheet: CPU currents, " \
+                                    "active modes"
+#define SOURCE_LOW_POWER            "estimate, datasheet: Deep Sleep and " \
+                                    "Hibernate currents"
+#define SOURCE_FILE                 "currents file"
+
+/* The accounting reaches the runner started by a Hibernate wakeup reset in
+ * this environment variable, so that the summary covers the whole run */
+#define MODEL_ENV                   "POWER_HOST_MODEL"
+
+#define VIOLATION_TEXT_LEN          (160U)
+
+/* Bits of the clock limits found exceeded at the last event */
+#define LIMIT_DPLL                  (1UL << 0)
+#define LIMIT_HF0                   (1UL << 1)
+#define LIMIT_HF1                   (1UL << 2)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Clocks of the fastest profile of a system power mode; the DPLL-LP is off in
+ * ULP */
+typedef struct
+{
+    uint32_t dpll_max_hz;
+    uint32_t hf0_max_hz;
+    uint32_t hf1_max_hz;
+} mode_limit_t;
+
+/* Modeled state that the current depends on */
+typedef struct
+{
+    uint32_t spec_id;               /* SPEC ID whose conditions match        */
+    bool cm33_extra;                /* CM33 active where the SPEC ID sleeps  */
+    uint32_t sram_macros;           /* SRAM macros retained in SIDDSA        */
+} power_class_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const mode_names[MODE_COUNT] = { "HP", "LP", "ULP" };
+
+static const mode_limit_t mode_limits[MODE_COUNT] =
+{
+    [MODE_HP]  = { 400000000U, 200000000U, 400000000U },
+    [MODE_LP]  = { 140000000U,  70000000U, 140000000U },
+    [MODE_ULP] = {          0U,  50000000U,  50000000U }
+};
+
+static const char *const spec_id_names[SPEC_ID_COUNT] =
+{
+    [SIDH00A] = "SIDH00A", [SIDH01A] = "SIDH01A", [SIDH10A] = "SIDH10A",
+    [SIDH12A] = "SIDH12A", [SIDH14A] = "SIDH14A", [SIDH20A] = "SIDH20A",
+    [SIDL00B] = "SIDL00B", [SIDL01B] = "SIDL01B", [SIDL10B] = "SIDL10B",
+    [SIDL12B] = "SIDL12B", [SIDL14B] = "SIDL14B", [SIDL20B] = "SIDL20B",
+    [SIDU00C] = "SIDU00C", [SIDU01C] = "SIDU01C", [SIDU10C] = "SIDU10C",
+    [SIDU12C] = "SIDU12C", [SIDU14C] = "SIDU14C", [SIDU20C] = "SIDU20C",
+    [SIDDSO]  = "SIDDSO",  [SIDHIBA] = "SIDHIBA", [SIDDSA]  = "SIDDSA"
+};
+
+/* Supply current of each SPEC ID in uA, with its source below. The built-in
+ * values are estimates in the order of magnitude of the SPEC IDs, not
+ * datasheet values; load the typical values of the datasheet, or measured
+ * ones, with host_power_load_currents(). */
+static uint32_t spec_id_current_ua[SPEC_ID_COUNT] =
+{
+    [SIDH00A] =  2800U, [SIDH01A] =  6500U, [SIDH10A] =  3600U,
+    [SIDH12A] =  4200U, [SIDH14A] =  9800U, [SIDH20A] = 13500U,
+    [SIDL00B] =  1100U, [SIDL01B] =  2400U, [SIDL10B] =  1700U,
+    [SIDL12B] =  2000U, [SIDL14B] =  4300U, [SIDL20B] =  5600U,
+    [SIDU00C] =   450U, [SIDU01C] =   900U, [SIDU10C] =   700U,
+    [SIDU12C] =   800U, [SIDU14C] =  1500U, [SIDU20C] =  1900U,
+    [SIDDSO]  =    60U, [SIDHIBA] =     2U, [SIDDSA]  =    70U
+};
+
+static const char *spec_id_current_source[SPEC_ID_COUNT] =
+{
+    [SIDH00A] = SOURCE_ACTIVE,    [SIDH01A] = SOURCE_ACTIVE,
+    [SIDH10A] = SOURCE_ACTIVE,    [SIDH12A] = SOURCE_ACTIVE,
+    [SIDH14A] = SOURCE_ACTIVE,    [SIDH20A] = SOURCE_ACTIVE,
+    [SIDL00B] = SOURCE_ACTIVE,    [SIDL01B] = SOURCE_ACTIVE,
+    [SIDL10B] = SOURCE_ACTIVE,    [SIDL12B] = SOURCE_ACTIVE,
+    [SIDL14B] = SOURCE_ACTIVE,    [SIDL20B] = SOURCE_ACTIVE,
+    [SIDU00C] = SOURCE_ACTIVE,    [SIDU01C] = SOURCE_ACTIVE,
+    [SIDU10C] = SOURCE_ACTIVE,    [SIDU12C] = SOURCE_ACTIVE,
+    [SIDU14C] = SOURCE_ACTIVE,    [SIDU20C] = SOURCE_ACTIVE,
+    [SIDDSO]  = SOURCE_LOW_POWER, [SIDHIBA] = SOURCE_LOW_POWER,
+    [SIDDSA]  = SOURCE_LOW_POWER
+};
+
+/* Current added to SIDDSA by each retained 64-KB SRAM macro in uA, also an
+ * estimate (SOURCE_LOW_POWER) */
+static uint32_t sram_macro_current_ua = 5U;
+
+/* Time spent in each class, and the class since the last event */
+static uint64_t class_time_us[SPEC_ID_COUNT][2];
+static uint64_t sram_macro_time_us;         /* Sum of macros x time, SIDDSA */
+static power_class_t current_class = { SIDH20A, false, 0U };
+static uint64_t class_start_us;
+
+/* A limit that stays exceeded over several events is reported once */
+static uint32_t limits_exceeded;
+
+/*******************************************************************************
+* Power model
+*******************************************************************************/
+/* Called with the state locked */
+static uint32_t system_mode(void)
+{
+    if (0U != (host_soc.syspm_status & CY_SYSPM_STATUS_SYSTEM_ULP))
+    {
+        return MODE_ULP;
+    }
+    if (0U != (host_soc.syspm_status & CY_SYSPM_STATUS_SYSTEM_LP))
+    {
+        return MODE_LP;
+    }
+
+    return MODE_HP;
+}
+
+/* SPEC ID of the state: the first digit is the CM55 (0: PD1 off, 1: CM55
+ * off, 2: CM55 active), the second the CM33 or the CM55 sleep. A CM33 that
+ * runs where the SPEC ID lets it sleep is added as cm33_extra. System Deep
+ * Sleep is SIDDSO in Deep Sleep-OFF and SIDDSA with the SRAM macros that stay
+ * on otherwise. Called with the state locked. */
+static power_class_t classify(void)
+{
+    static const uint32_t first_spec_id[MODE_COUNT] =
+    {
+        SIDH00A, SIDL00B, SIDU00C
+    };
+    power_class_t class = { 0U, false, 0U };
+    uint32_t sram;
+    host_cpu_state_t cm33 = host_soc.cpu_state[HOST_CORE_CM33];
+    host_cpu_state_t cm55 = host_soc.cpu_state[HOST_CORE_CM55];
+    bool cm33_active = (HOST_CPU_ACTIVE == cm33);
+    bool cm55_off = !host_soc.cm55_enabled ||
+        (PPU_V1_MODE_OFF == host_ppu[HOST_PPU_APPCPU].PWSR);
+    uint32_t base = first_spec_id[system_mode()];
+
+    if (host_soc.hibernated)
+    {
+        class.spec_id = SIDHIBA;
+    }
+    else if ((HOST_CPU_DEEP_SLEEP == cm33) &&
+             (cm55_off || (HOST_CPU_DEEP_SLEEP == cm55)))
+    {
+        class.spec_id = SIDDSO;
+        if (CY_SYSPM_MODE_DEEPSLEEP_OFF != host_soc.deep_sleep_mode)
+        {
+            class.spec_id = SIDDSA;
+            for (sram = 0U; sram < HOST_SRAM_COUNT; sram++)
+            {
+                class.sram_macros += (uint32_t)__builtin_popcount(
+                    host_soc.sram_macros_on[sram]);
+            }
+        }
+    }
+    else if (PPU_V1_MODE_OFF == host_ppu[HOST_PPU_PD1].PWSR)
+    {
+        class.spec_id = base + (cm33_active ? 1U : 0U);         /* x00, x01 */
+    }
+    else if (cm55_off)
+    {
+        class.spec_id = base + 2U;                              /* x10      */
+        class.cm33_extra = cm33_active;
+    }
+    else if (HOST_CPU_ACTIVE != cm55)
+    {
+        class.spec_id = base + 3U;                              /* x12      */
+        class.cm33_extra = cm33_active;
+    }
+    else
+    {
+        class.spec_id = base + (cm33_active ? 5U : 4U);         /* x14, x20 */
+    }
+
+    return class;
+}
+
+/* Current of a class in uA */
+static uint32_t class_current_ua(uint32_t spec_id, bool cm33_extra)
+{
+    uint32_t current = spec_id_current_ua[spec_id];
+    uint32_t base;
+
+    if (cm33_extra)
+    {
+        /* Add the CM33 active current of the mode: x01 - x00 */
+        base = ((spec_id - 1U) / 6U) * 6U + 1U;
+        current += spec_id_current_ua[base + 1U] - spec_id_current_ua[base];
+    }
+
+    return current;
+}
+
+/* Charge of the time spent in a class in uA x us */
+static uint64_t class_charge_uaus(uint32_t spec_id, uint32_t extra)
+{
+    uint64_t charge = class_time_us[spec_id][extra] *
+                      class_current_ua(spec_id, 0U != extra);
+
+    if (SIDDSA == spec_id)
+    {
+        charge += sram_macro_time_us * sram_macro_current_ua;
+    }
+
+    return charge;
+}
+
+static void report_violation(const char *format, ...)
+    __attribute__((format(printf, 1, 2)));
+
+static void report_violation(const char *format, ...)
+{
+    char text[VIOLATION_TEXT_LEN];
+    va_list args;
+
+    va_start(args, format);
+    (void)vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    host_lock();
+    host_soc.violations++;
+    host_unlock();
+    host_trace("ILLEGAL: %s", text);
+}
+
+/* Checks the clocks against the limits of the system power mode. A limit is
+ * reported when it becomes exceeded. */
+static void check_clocks(void)
+{
+    uint32_t mode;
+    bool pll_enabled;
+    uint32_t pll_freq;
+    uint32_t hf0;
+    uint32_t hf1;
+    uint32_t exceeded = 0U;
+    uint32_t reported;
+
+    hf0 = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+    hf1 = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF1);
+
+    host_lock();
+    mode = system_mode();
+    pll_enabled = host_soc.pll_enabled;
+    pll_freq = host_soc.pll_freq_hz;
+    if (pll_enabled && (pll_freq > mode_limits[mode].dpll_max_hz))
+    {
+        exceeded |= LIMIT_DPLL;
+    }
+    if (hf0 > mode_limits[mode].hf0_max_hz)
+    {
+        exceeded |= LIMIT_HF0;
+    }
+    if (hf1 > mode_limits[mode].hf1_max_hz)
+    {
+        exceeded |= LIMIT_HF1;
+    }
+    reported = exceeded & ~limits_exceeded;
+    limits_exceeded = exceeded;
+    host_unlock();
+
+    if (0U != (reported & LIMIT_DPLL))
+    {
+        report_violation("DPLL-LP at %u Hz in %s (limit %u Hz)",
+                         (unsigned)pll_freq, mode_names[mode],
+                         (unsigned)mode_limits[mode].dpll_max_hz);
+    }
+    if (0U != (reported & LIMIT_HF0))
+    {
+        report_violation("CLK_HF0 at %u Hz in %s (limit %u Hz)",
+                         (unsigned)hf0, mode_names[mode],
+                         (unsigned)mode_limits[mode].hf0_max_hz);
+    }
+    if (0U != (reported & LIMIT_HF1))
+    {
+        report_violation("CLK_HF1 at %u Hz in %s (limit %u Hz)",
+                         (unsigned)hf1, mode_names[mode],
+                         (unsigned)mode_limits[mode].hf1_max_hz);
+    }
+}
+
+void host_power_event(void)
+{
+    uint64_t now_us;
+
+    check_clocks();
+
+    host_lock();
+    now_us = host_time_us();
+    class_time_us[current_class.spec_id][current_class.cm33_extra ? 1 : 0] +=
+        now_us - class_start_us;
+    sram_macro_time_us += (now_us - class_start_us) * current_class.sram_macros;
+    class_start_us = now_us;
+    current_class = classify();
+    host_unlock();
+}
+
+void host_power_violation(const char *reason)
+{
+    report_violation("%s", reason);
+}
+
+bool host_power_load_currents(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char name[16];
+    unsigned current;
+    uint32_t index;
+    bool found;
+
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    while (2 == fscanf(file, "%15s %u", name, &current))
+    {
+        found = (0 == strcmp(name, SRAM_MACRO_NAME));
+        if (found)
+        {
+            sram_macro_current_ua = current;
+        }
+        for (index = 0U; index < SPEC_ID_COUNT; index++)
+        {
+            if ((NULL != spec_id_names[index]) &&
+                (0 == strcmp(spec_id_names[index], name)))
+            {
+                spec_id_current_ua[index] = current;
+                spec_id_current_source[index] = SOURCE_FILE;
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            (void)fclose(file);
+            return false;
+        }
+    }
+
+    found = (0 != feof(file));
+    (void)fclose(file);
+
+    return found;
+}
+
+void host_power_print_summary(void)
+{
+    uint64_t total_us = 0U;
+    uint64_t charge = 0U;
+    uint64_t time_us;
+    uint32_t index;
+    uint32_t extra;
+
+    host_power_event();
+
+    host_lock();
+    for (index = 0U; index < SPEC_ID_COUNT; index++)
+    {
+        for (extra = 0U; extra < 2U; extra++)
+        {
+            time_us = class_time_us[index][extra];
+            if (0U != time_us)
+            {
+                total_us += time_us;
+                charge += class_charge_uaus(index, extra);
+            }
+        }
+    }
+
+    (void)printf("illegal sequences : %u\n", (unsigned)host_soc.violations);
+    (void)printf("current estimate  : %u uA average over %u ms\n",
+                 (unsigned)((0U != total_us) ? (charge / total_us) : 0U),
+                 (unsigned)(total_us / 1000U));
+    for (index = 0U; index < SPEC_ID_COUNT; index++)
+    {
+        for (extra = 0U; extra < 2U; extra++)
+        {
+            time_us = class_time_us[index][extra];
+            if ((0U == time_us) || (NULL == spec_id_names[index]))
+            {
+                continue;
+            }
+            (void)printf("  %-7s %-11s %6u uA %5u.%u%%  %s\n",
+                         spec_id_names[index],
+                         (0U != extra) ? "+cm33 run" : "",
+                         (unsigned)(class_charge_uaus(index, extra) / time_us),
+                         (unsigned)((time_us * 100U) / total_us),
+                         (unsigned)(((time_us * 1000U) / total_us) % 10U),
+                         spec_id_current_source[index]);
+        }
+    }
+    host_unlock();
+}
+
+void host_power_init(void)
+{
+    char *text = getenv(MODEL_ENV);
+    uint32_t index;
+    uint32_t extra;
+
+    memset(class_time_us, 0, sizeof(class_time_us));
+    sram_macro_time_us = 0U;
+    limits_exceeded = 0U;
+
+    /* Started by a Hibernate wakeup reset: add the time before it */
+    if (NULL != text)
+    {
+        for (index = 0U; index < SPEC_ID_COUNT; index++)
+        {
+            for (extra = 0U; extra < 2U; extra++)
+            {
+                class_time_us[index][extra] = strtoull(text, &text, 16);
+                text += (',' == *text) ? 1 : 0;
+            }
+        }
+        sram_macro_time_us = strtoull(text, &text, 16);
+        (void)unsetenv(MODEL_ENV);
+    }
+
+    class_start_us = host_time_us();
+    current_class = classify();
+}
+
+void host_power_pass_to_reset(void)
+{
+    char text[((SPEC_ID_COUNT * 2U) + 1U) * 17U + 1U];
+    size_t length = 0U;
+    uint32_t index;
+    uint32_t extra;
+
+    /* Closes the interval of the current class, Hibernate at a wakeup */
+    host_power_event();
+
+    host_lock();
+    for (index = 0U; index < SPEC_ID_COUNT; index++)
+    {
+        for (extra = 0U; extra < 2U; extra++)
+        {
+            length += (size_t)snprintf(&text[length], sizeof(text) - length,
+                "%llx,", (unsigned long long)class_time_us[index][extra]);
+        }
+    }
+    (void)snprintf(&text[length], sizeof(text) - length, "%llx",
+                   (unsigned long long)sram_macro_time_us);
+    host_unlock();
+
+    (void)setenv(MODEL_ENV, text, 1);
+}
+
+/* [] END OF FILE */
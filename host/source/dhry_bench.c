@@ -0,0 +1,337 @@
+/*******************************************************************************
+* File Name        : dhry_bench.c
+*
+* Description      : Host Dhrystone benchmark. It scores the reference
+*                    (globals-based) Dhrystone on one thread, then runs the
+*                    re-entrant variant on 1..N threads with one context each
+*                    and reports how the aggregate throughput scales.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cycle_counter.h"
+#include "dhry_ctx.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DEFAULT_ITERATIONS          (5000000U)
+#define DEFAULT_MAX_THREADS         (4U)
+
+#define DHRY_SOME_STRING            "DHRYSTONE PROGRAM, SOME STRING"
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    pthread_t thread;
+    dhry_ctx_t *ctx;
+    uint32_t iterations;
+    uint32_t begin_ns;
+    uint32_t elapsed_ns;
+} bench_thread_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static pthread_barrier_t start_barrier;
+
+/* State of the reference Dhrystone, defined in dhry_1.c */
+extern Rec_Pointer Ptr_Glob;
+extern Rec_Pointer Next_Ptr_Glob;
+extern int Int_Glob;
+extern Boolean Bool_Glob;
+extern char Ch_1_Glob;
+extern char Ch_2_Glob;
+extern int Arr_1_Glob[50];
+extern int Arr_2_Glob[50][50];
+
+/*******************************************************************************
+* Function Name: fatal
+********************************************************************************
+* Summary:
+* Prints an error message and ends the benchmark.
+*
+*******************************************************************************/
+static void fatal(const char *message)
+{
+    (void)fprintf(stderr, "dhry_bench: %s\n", message);
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: same_record
+********************************************************************************
+* Summary:
+* Compares the variant-1 fields of two Dhrystone records.
+*
+*******************************************************************************/
+static bool same_record(const Rec_Type *a, const Rec_Type *b)
+{
+    return (a->Discr == b->Discr) &&
+           (a->variant.var_1.Enum_Comp == b->variant.var_1.Enum_Comp) &&
+           (a->variant.var_1.Int_Comp == b->variant.var_1.Int_Comp) &&
+           (0 == strcmp(a->variant.var_1.Str_Comp, b->variant.var_1.Str_Comp));
+}
+
+/*******************************************************************************
+* Function Name: check_ctx
+********************************************************************************
+* Summary:
+* Checks the final state of a context after 'runs' iterations against the
+* values that dhry_1.c lists as "should be", and against the state that the
+* reference Dhrystone left after the same number of runs.
+*
+* Parameters:
+*  ctx: Context after dhry_ctx_run()
+*  runs: Iterations run on the context and on the reference Dhrystone
+*
+*******************************************************************************/
+static void check_ctx(const dhry_ctx_t *ctx, uint32_t runs)
+{
+    const Rec_Type *rec = ctx->Ptr_Glob;
+    const Rec_Type *next = ctx->Next_Ptr_Glob;
+
+    if ((5 != ctx->Int_Glob) || (1 != ctx->Bool_Glob) ||
+        ('A' != ctx->Ch_1_Glob) || ('B' != ctx->Ch_2_Glob) ||
+        (7 != ctx->Arr_1_Glob[8]) ||
+        ((int)(runs + 10U) != ctx->Arr_2_Glob[8][7]))
+    {
+        fatal("context globals differ from the expected values");
+    }
+
+    if ((rec->Ptr_Comp != ctx->Next_Ptr_Glob) ||
+        (next->Ptr_Comp != ctx->Next_Ptr_Glob) ||
+        (Ident_1 != rec->Discr) ||
+        (Ident_3 != rec->variant.var_1.Enum_Comp) ||
+        (17 != rec->variant.var_1.Int_Comp) ||
+        (0 != strcmp(rec->variant.var_1.Str_Comp, DHRY_SOME_STRING)) ||
+        (Ident_1 != next->Discr) ||
+        (Ident_2 != next->variant.var_1.Enum_Comp) ||
+        (18 != next->variant.var_1.Int_Comp) ||
+        (0 != strcmp(next->variant.var_1.Str_Comp, DHRY_SOME_STRING)))
+    {
+        fatal("context records differ from the expected values");
+    }
+
+    /* Int_2_Loc is 9, not the published 13: dhry_1.c has the statement */
+    /* "Int_2_Loc = 7 * (Int_2_Loc - Int_3_Loc) - Int_1_Loc" commented  */
+    /* out, and dhry_ctx_1.c follows it.                                 */
+    if ((5 != ctx->Int_1_Loc) || (9 != ctx->Int_2_Loc) ||
+        (7 != ctx->Int_3_Loc) || (Ident_2 != ctx->Enum_Loc) ||
+        (0 != strcmp(ctx->Str_1_Loc, "DHRYSTONE PROGRAM, 1'ST STRING")) ||
+        (0 != strcmp(ctx->Str_2_Loc, "DHRYSTONE PROGRAM, 2'ND STRING")))
+    {
+        fatal("context locals differ from the expected values");
+    }
+
+    if ((Int_Glob != ctx->Int_Glob) || (Bool_Glob != ctx->Bool_Glob) ||
+        (Ch_1_Glob != ctx->Ch_1_Glob) || (Ch_2_Glob != ctx->Ch_2_Glob) ||
+        (Arr_1_Glob[8] != ctx->Arr_1_Glob[8]) ||
+        (Arr_2_Glob[8][7] != ctx->Arr_2_Glob[8][7]) ||
+        (!same_record(Ptr_Glob, rec)) ||
+        (!same_record(Next_Ptr_Glob, next)))
+    {
+        fatal("context state differs from the reference Dhrystone");
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_thread_main
+********************************************************************************
+* Summary:
+* Runs the configured number of iterations on the thread's own context once
+* all threads are ready.
+*
+*******************************************************************************/
+static void *bench_thread_main(void *arg)
+{
+    bench_thread_t *bench = (bench_thread_t *)arg;
+
+    (void)pthread_barrier_wait(&start_barrier);
+    bench->begin_ns = cycle_counter_read();
+    dhry_ctx_run(bench->ctx, bench->iterations);
+    bench->elapsed_ns = cycle_counter_read() - bench->begin_ns;
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: run_threads
+********************************************************************************
+* Summary:
+* Runs the re-entrant Dhrystone on the given number of threads. The
+* aggregate rate is the iterations of all threads over the time from the
+* first start to the last end, so a thread that starts late or is descheduled
+* lowers it. The whole run must fit in the 4.29 s range of the counter.
+*
+* Return:
+*  float: Aggregate Dhrystones per second of all threads
+*
+*******************************************************************************/
+static float run_threads(uint32_t thread_count, uint32_t iterations)
+{
+    bench_thread_t *bench = calloc(thread_count, sizeof(*bench));
+    int64_t first_begin = 0;
+    int64_t last_end = 0;
+    int64_t begin;
+    uint32_t index;
+
+    if (NULL == bench)
+    {
+        fatal("out of memory");
+    }
+    (void)pthread_barrier_init(&start_barrier, NULL, thread_count);
+
+    for (index = 0U; index < thread_count; index++)
+    {
+        bench[index].ctx = malloc(sizeof(dhry_ctx_t));
+        if (NULL == bench[index].ctx)
+        {
+            fatal("out of memory");
+        }
+        dhry_ctx_init(bench[index].ctx);
+        bench[index].iterations = iterations;
+        if (0 != pthread_create(&bench[index].thread, NULL, bench_thread_main,
+                                &bench[index]))
+        {
+            fatal("pthread_create failed");
+        }
+    }
+
+    for (index = 0U; index < thread_count; index++)
+    {
+        (void)pthread_join(bench[index].thread, NULL);
+        if (bench[index].ctx->Run_Count != iterations)
+        {
+            fatal("context iteration count mismatch");
+        }
+        check_ctx(bench[index].ctx, iterations);
+
+        /* Times relative to the start of the first thread, across a wrap */
+        begin = (int32_t)(bench[index].begin_ns - bench[0].begin_ns);
+        if (begin < first_begin)
+        {
+            first_begin = begin;
+        }
+        if ((begin + bench[index].elapsed_ns) > last_end)
+        {
+            last_end = begin + bench[index].elapsed_ns;
+        }
+        free(bench[index].ctx);
+    }
+
+    (void)pthread_barrier_destroy(&start_barrier);
+    free(bench);
+
+    if (last_end <= first_begin)
+    {
+        fatal("no time elapsed");
+    }
+
+    return ((float)thread_count * (float)iterations *
+            (float)CYCLE_COUNTER_HOST_HZ) / (float)(last_end - first_begin);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Usage: dhry_bench [-n iterations] [-j max_threads]
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = DEFAULT_ITERATIONS;
+    uint32_t max_threads = DEFAULT_MAX_THREADS;
+    dhry_score_t score;
+    float single_dps = 0.0f;
+    uint32_t threads;
+    int index;
+
+    for (index = 1; index < argc; index++)
+    {
+        if ((0 == strcmp(argv[index], "-n")) && ((index + 1) < argc))
+        {
+            iterations = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-j")) && ((index + 1) < argc))
+        {
+            max_threads = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-n iterations] [-j max_threads]\n",
+                          argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((0U == iterations) || (0U == max_threads))
+    {
+        (void)fprintf(stderr, "iterations and threads must be non-zero\n");
+        return EXIT_FAILURE;
+    }
+
+    /* The nanosecond counter wraps after 4.29 s. The context runs below */
+    /* use the same count, so check_ctx() can compare with this state.   */
+    dhrystone_init();
+    dhrystone_measure(iterations, CYCLE_COUNTER_HOST_HZ, &score);
+    (void)printf("reference : %10.0f Dhrystones/s %9.1f DMIPS\n",
+                 score.dhrystones_per_sec, score.dmips);
+
+    (void)printf("threads   : Dhrystones/s (all)  DMIPS (all)  scaling\n");
+    for (threads = 1U; threads <= max_threads; threads *= 2U)
+    {
+        float dps = run_threads(threads, iterations);
+
+        if (1U == threads)
+        {
+            single_dps = dps;
+        }
+        (void)printf("%9u : %18.0f %12.1f %7.2fx\n", (unsigned)threads, dps,
+                     dps / DHRY_VAX_MIPS_DIVISOR, dps / single_dps);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
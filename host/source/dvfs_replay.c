@@ -0,0 +1,212 @@
+/*******************************************************************************
+* File Name        : dvfs_replay.c
+*
+* Description      : This file is a host tool that replays a load trace
+*                    through the DVFS governor and prints the operating point
+*                    of every window, so that governor settings can be
+*                    checked without hardware.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dvfs_governor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define LINE_LENGTH                 (256U)
+
+/*******************************************************************************
+* Function Name: parse_capacity
+********************************************************************************
+* Summary:
+* Reads a comma-separated list of level capacities, slowest first.
+*
+*******************************************************************************/
+static unsigned parse_capacity(const char *text, uint32_t *capacity)
+{
+    unsigned count = 0U;
+    char *end;
+
+    while (count < DVFS_GOVERNOR_MAX_LEVELS)
+    {
+        capacity[count++] = (uint32_t)strtoul(text, &end, 0);
+        if (',' != *end)
+        {
+            break;
+        }
+        text = end + 1;
+    }
+
+    return ('\0' == *end) ? count : 0U;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Reads one demand per line from a file, or from stdin: the busy time that
+* the work of a window takes at the fastest level, in permille of the window.
+* Demands above 1000 do not fit in a window even at the fastest level. For
+* every window it prints "window,demand,load,level", where load is the busy
+* time at the current level given to the governor, and a comment line with
+* the levels and capacities of each change. A summary of the windows per
+* level, the level changes and the saturated windows follows.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, or EXIT_FAILURE on a bad command line or input
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    static uint32_t capacity[DVFS_GOVERNOR_MAX_LEVELS] = { 50U, 70U, 200U };
+    dvfs_governor_config_t config =
+    {
+        3U, capacity, 800U, 300U, 1U, 3U
+    };
+    unsigned long level_windows[DVFS_GOVERNOR_MAX_LEVELS] = { 0U };
+    unsigned long windows = 0U;
+    unsigned long transitions = 0U;
+    unsigned long saturated = 0U;
+    dvfs_governor_t gov;
+    const char *path = NULL;
+    FILE *file = stdin;
+    char line[LINE_LENGTH];
+    unsigned long demand;
+    uint32_t load;
+    uint32_t level;
+    int index;
+
+    for (index = 1; index < argc; index++)
+    {
+        if ((0 == strcmp(argv[index], "-u")) && ((index + 1) < argc))
+        {
+            config.up_permille = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-d")) && ((index + 1) < argc))
+        {
+            config.down_permille = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-U")) && ((index + 1) < argc))
+        {
+            config.up_windows = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-D")) && ((index + 1) < argc))
+        {
+            config.down_windows = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-c")) && ((index + 1) < argc))
+        {
+            config.levels = parse_capacity(argv[++index], capacity);
+        }
+        else if ((NULL == path) && ('-' != argv[index][0]))
+        {
+            path = argv[index];
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-u up_permille] "
+                          "[-d down_permille] [-U up_windows] "
+                          "[-D down_windows] [-c capacity,...] "
+                          "[trace.txt]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* Start at the fastest level, as the DVFS workload does */
+    if (!dvfs_governor_init(&gov, &config, config.levels - 1U))
+    {
+        (void)fprintf(stderr, "%s: invalid governor settings\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if ((NULL != path) && (NULL == (file = fopen(path, "r"))))
+    {
+        (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], path);
+        return EXIT_FAILURE;
+    }
+
+    (void)printf("window,demand,load,level\n");
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        /* Skips headers and comments */
+        if (1 != sscanf(line, "%lu", &demand))
+        {
+            continue;
+        }
+
+        level = gov.level;
+        load = (uint32_t)((demand * capacity[config.levels - 1U]) /
+                          capacity[level]);
+        if (load >= DVFS_GOVERNOR_FULL_LOAD)
+        {
+            load = DVFS_GOVERNOR_FULL_LOAD;
+            saturated++;
+        }
+
+        (void)printf("%lu,%lu,%u,%u\n", windows, demand, load, level);
+
+        level_windows[level]++;
+        windows++;
+        if (level != dvfs_governor_update(&gov, load))
+        {
+            (void)printf("# level %u -> %u, capacity %u -> %u\n", level,
+                         gov.level, capacity[level], capacity[gov.level]);
+            transitions++;
+        }
+    }
+
+    (void)printf("# windows %lu, transitions %lu, saturated %lu\n", windows,
+                 transitions, saturated);
+    for (level = 0U; level < config.levels; level++)
+    {
+        (void)printf("# level %u (capacity %u): %lu windows\n", level,
+                     capacity[level], level_windows[level]);
+    }
+
+    if (stdin != file)
+    {
+        (void)fclose(file);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
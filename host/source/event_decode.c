@@ -0,0 +1,241 @@
+/*******************************************************************************
+* File Name        : event_decode.c
+*
+* Description      : Decodes the binary event trace. The input is the file
+*                    written by "power_host -e", or memory dumps of
+*                    event_trace_log of each core and of the backup registers
+*                    taken with a debugger, concatenated in any order.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "event_trace.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const event_names[EVENT_TRACE_EVENT_COUNT] =
+{
+    [EVENT_TRACE_BOOT]             = "boot",
+    [EVENT_TRACE_TRANSITION_BEGIN] = "transition_begin",
+    [EVENT_TRACE_TRANSITION_END]   = "transition_end",
+    [EVENT_TRACE_SYSTEM_MODE]      = "system_mode",
+    [EVENT_TRACE_DOMAINS]          = "domains",
+    [EVENT_TRACE_CM55_START]       = "cm55_start",
+    [EVENT_TRACE_SLEEP_ENTER]      = "sleep_enter",
+    [EVENT_TRACE_SLEEP_EXIT]       = "sleep_exit",
+    [EVENT_TRACE_DEEP_SLEEP_ENTER] = "deep_sleep_enter",
+    [EVENT_TRACE_DEEP_SLEEP_EXIT]  = "deep_sleep_exit",
+    [EVENT_TRACE_HIBERNATE]        = "hibernate"
+};
+
+static const char *const core_names[] = { "cm33", "cm55" };
+
+/*******************************************************************************
+* Function Name: print_record
+********************************************************************************
+* Summary:
+* Prints one record as a CSV line.
+*
+*******************************************************************************/
+static void print_record(const char *source, uint32_t seq,
+                         const event_trace_record_t *record)
+{
+    const char *event = NULL;
+    const char *core = "?";
+
+    if (record->event < EVENT_TRACE_EVENT_COUNT)
+    {
+        event = event_names[record->event];
+    }
+    if (record->core < (sizeof(core_names) / sizeof(core_names[0])))
+    {
+        core = core_names[record->core];
+    }
+
+    (void)printf("%s,%s,%u,%u,%u,", source, core, (unsigned)record->boot,
+                 (unsigned)seq, (unsigned)record->timestamp);
+    if (NULL != event)
+    {
+        (void)printf("%s,", event);
+    }
+    else
+    {
+        (void)printf("event_%u,", (unsigned)record->event);
+    }
+    (void)printf("0x%08x\n", (unsigned)record->payload);
+}
+
+/*******************************************************************************
+* Function Name: print_log
+********************************************************************************
+* Summary:
+* Prints the records of a core log, oldest first.
+*
+*******************************************************************************/
+static void print_log(const event_trace_log_t *trace_log)
+{
+    uint32_t head = trace_log->head;
+    uint32_t count = (head < EVENT_TRACE_RECORDS) ? head : EVENT_TRACE_RECORDS;
+    uint32_t seq;
+
+    for (seq = head - count; seq != head; seq++)
+    {
+        print_record("log", seq,
+                     &trace_log->records[seq & (EVENT_TRACE_RECORDS - 1U)]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_breg
+********************************************************************************
+* Summary:
+* Prints the records that the CM33 saved in the backup registers before
+* Hibernate.
+*
+*******************************************************************************/
+static void print_breg(const uint32_t *breg)
+{
+    event_trace_record_t record;
+    uint32_t count = breg[1];
+    uint32_t index;
+
+    if (count > EVENT_TRACE_BREG_RECORDS)
+    {
+        count = EVENT_TRACE_BREG_RECORDS;
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        (void)memcpy(&record, &breg[EVENT_TRACE_BREG_HEADER +
+                                    (index * EVENT_TRACE_RECORD_WORDS)],
+                     sizeof(record));
+        print_record("backup", index, &record);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Reads event trace blocks from a file, or from stdin, and prints
+* "source,core,boot,seq,timestamp,event,payload" for every record. A block
+* is a core log, recognized by EVENT_TRACE_MAGIC, or the backup registers,
+* recognized by EVENT_TRACE_BREG_MAGIC. The timestamps are cycles of the core
+* (nanoseconds on the host) and restart with every boot.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, or EXIT_FAILURE on a bad command line or input
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    static event_trace_log_t trace_log;
+    uint32_t breg[EVENT_TRACE_BREG_WORDS];
+    const char *path = NULL;
+    FILE *file = stdin;
+    uint32_t magic;
+    bool valid = true;
+    int index;
+
+    for (index = 1; index < argc; index++)
+    {
+        if ((NULL == path) && ('-' != argv[index][0]))
+        {
+            path = argv[index];
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [trace.bin]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((NULL != path) && (NULL == (file = fopen(path, "rb"))))
+    {
+        (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], path);
+        return EXIT_FAILURE;
+    }
+
+    (void)printf("source,core,boot,seq,timestamp,event,payload\n");
+    while (valid && (1U == fread(&magic, sizeof(magic), 1U, file)))
+    {
+        if (EVENT_TRACE_MAGIC == magic)
+        {
+            trace_log.magic = magic;
+            valid = (1U == fread((uint8_t *)&trace_log + sizeof(magic),
+                                 sizeof(trace_log) - sizeof(magic), 1U, file));
+            if (valid)
+            {
+                print_log(&trace_log);
+            }
+        }
+        else if (EVENT_TRACE_BREG_MAGIC == (magic >> 16))
+        {
+            breg[0] = magic;
+            valid = (1U == fread(&breg[1], sizeof(breg) - sizeof(magic), 1U,
+                                 file));
+            if (valid)
+            {
+                print_breg(breg);
+            }
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+
+    if (stdin != file)
+    {
+        (void)fclose(file);
+    }
+
+    if (!valid)
+    {
+        (void)fprintf(stderr, "%s: not an event trace block\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
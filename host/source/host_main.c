@@ -0,0 +1,589 @@
+/*******************************************************************************
+* File Name        : host_main.c
+*
+* Description      : Host runner. It boots the CM33 non-secure image on a
+*                    thread, lets the application run for a given time and
+*                    then prints the modeled SoC state and the workload
+*                    counters of both core images.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cy_host.h"
+#include "dhry.h"
+#include "dhry_prof.h"
+#include "transition_bench.h"
+#include "ring_bench.h"
+#include "race_pace.h"
+#include "freq_sweep.h"
+#include "gating.h"
+#include "event_trace.h"
+#include "hibernate_bench.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DEFAULT_RUN_TIME_MS         (1000U)
+
+/* Interval of the check for the end of a Hibernate benchmark */
+#define HIBERNATE_BENCH_POLL_MS     (10U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Exported from the core images, see IMAGE_EXPORTS in the host Makefile */
+extern volatile uint32_t cm33_dhry_run_count;
+extern volatile uint32_t cm55_dhry_run_count;
+extern const char cm33_dhry_code_placement[];
+extern const char cm55_dhry_code_placement[];
+extern gating_audit_t cm33_gating_audit;
+uint32_t cm33_gating_audit_format(const gating_audit_t *audit, char *text,
+                                  uint32_t size);
+
+/* Only present when the images are built with DHRY_ITERATIONS */
+extern dhry_score_t cm33_dhry_score __attribute__((weak));
+extern dhry_score_t cm55_dhry_score __attribute__((weak));
+
+/* Only present when the images are built with DHRY_PROFILE */
+extern dhry_prof_t cm33_dhry_prof __attribute__((weak));
+extern dhry_prof_t cm55_dhry_prof __attribute__((weak));
+extern const char *const cm33_dhry_prof_names[DHRY_PROF_COUNT]
+    __attribute__((weak));
+
+/* Filled by the CM33 image when it is built with TRANSITION_BENCH_RUNS */
+extern transition_result_t cm33_transition_results[TRANSITION_COUNT]
+    __attribute__((weak));
+
+/* Filled by the CM33 image when it is built with RING_BENCH_MESSAGES */
+extern ring_bench_result_t cm33_ring_bench_results[RING_BENCH_MODES]
+    __attribute__((weak));
+
+/* Filled by the CM33 image when it is built with RACE_PACE_STEPS */
+extern race_pace_result_t cm33_race_pace_results[RACE_PACE_MAX_STRATEGIES]
+    __attribute__((weak));
+
+/* Filled by the CM33 image when it is built with FREQ_SWEEP_DWELL_MS */
+extern freq_sweep_result_t cm33_freq_sweep_results[FREQ_SWEEP_MAX_POINTS]
+    __attribute__((weak));
+
+/* Only present when the images are built with EVENT_TRACE_ENABLE */
+extern event_trace_log_t cm33_event_trace_log __attribute__((weak));
+extern event_trace_log_t cm55_event_trace_log __attribute__((weak));
+
+/* Filled by the CM33 image when it is built with HIBERNATE_BENCH_CYCLES */
+extern hibernate_bench_result_t cm33_hibernate_bench_results
+    __attribute__((weak));
+
+/*******************************************************************************
+* Function Name: print_dhry_score
+********************************************************************************
+* Summary:
+* Prints the score of the last bounded Dhrystone batch of a core.
+*
+* Parameters:
+*  core: Core name
+*  score: Score of the core image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_dhry_score(const char *core, const dhry_score_t *score)
+{
+    (void)printf("%s dhry score   : %u iterations, %u cycles at %u MHz, "
+                 "%.1f dmips, %.3f dmips/mhz\n", core,
+                 (unsigned)score->iterations, (unsigned)score->cycles,
+                 (unsigned)(score->clk_hz / 1000000U), score->dmips,
+                 score->dmips_per_mhz);
+}
+
+/*******************************************************************************
+* Function Name: print_dhry_prof
+********************************************************************************
+* Summary:
+* Prints the Dhrystone procedure histograms of one core. The host counts time
+* stamp counter ticks instead of CPU cycles.
+*
+* Parameters:
+*  core: Core name
+*  prof: Histograms of the core
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_dhry_prof(const char *core, const dhry_prof_t *prof)
+{
+    uint32_t id;
+    uint32_t bucket;
+
+    (void)printf("%s profile (overhead %u ticks)\n", core,
+                 (unsigned)prof->overhead_cycles);
+    (void)printf("  %-6s %10s %6s %6s %8s  log2 histogram\n", "proc",
+                 "calls", "min", "max", "mean");
+    for (id = 0U; id < DHRY_PROF_COUNT; id++)
+    {
+        const dhry_prof_hist_t *hist = &prof->hist[id];
+
+        if (0U == hist->calls)
+        {
+            continue;
+        }
+        (void)printf("  %-6s %10u %6u %6u %8.1f ", cm33_dhry_prof_names[id],
+                     (unsigned)hist->calls, (unsigned)hist->min_cycles,
+                     (unsigned)hist->max_cycles,
+                     (double)hist->total_cycles / (double)hist->calls);
+        for (bucket = 0U; bucket < DHRY_PROF_BUCKETS; bucket++)
+        {
+            (void)printf(" %u", (unsigned)hist->buckets[bucket]);
+        }
+        (void)printf("\n");
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_transition_results
+********************************************************************************
+* Summary:
+* Prints the statistics of the transitions that the CM33 benchmark completed.
+* The host times the stand-in PDL calls, not the device transitions.
+*
+* Parameters:
+*  results: Results of the CM33 image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_transition_results(const transition_result_t *results)
+{
+    uint32_t id;
+
+    (void)printf("transition latency (ns)\n");
+    (void)printf("  %-18s %5s %10s %10s %10s %10s\n", "transition", "runs",
+                 "min", "median", "p99", "max");
+    for (id = 0U; id < TRANSITION_COUNT; id++)
+    {
+        const bench_stats_t *ns = &results[id].ns;
+
+        if (0U == ns->count)
+        {
+            continue;
+        }
+        (void)printf("  %-18s %5u %10u %10u %10u %10u\n", results[id].name,
+                     (unsigned)ns->count, (unsigned)ns->min,
+                     (unsigned)ns->median, (unsigned)ns->p99,
+                     (unsigned)ns->max);
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_ring_bench_results
+********************************************************************************
+* Summary:
+* Prints the ring throughput and one-way latency of each measured power mode.
+*
+* Parameters:
+*  results: Results of the CM33 image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_ring_bench_results(const ring_bench_result_t *results)
+{
+    uint32_t mode;
+
+    (void)printf("ring benchmark (one-way latency in ns)\n");
+    (void)printf("  %-4s %12s %10s %10s %10s %10s\n", "mode", "messages/s",
+                 "min", "median", "p99", "max");
+    for (mode = 0U; mode < RING_BENCH_MODES; mode++)
+    {
+        const bench_stats_t *ns = &results[mode].one_way_ns;
+
+        if (0U == ns->count)
+        {
+            continue;
+        }
+        (void)printf("  %-4s %12u %10u %10u %10u %10u\n", results[mode].mode,
+                     (unsigned)results[mode].messages_per_s,
+                     (unsigned)ns->min, (unsigned)ns->median,
+                     (unsigned)ns->p99, (unsigned)ns->max);
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_race_pace_results
+********************************************************************************
+* Summary:
+* Prints the work times of the profiles that the comparison ran.
+*
+* Parameters:
+*  results: Results of the CM33 image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_race_pace_results(const race_pace_result_t *results)
+{
+    uint32_t index;
+
+    (void)printf("race/pace (work time in us)\n");
+    (void)printf("  %7s %6s %10s %10s %6s\n", "spec_id", "rounds", "last",
+                 "max", "missed");
+    for (index = 0U; index < RACE_PACE_MAX_STRATEGIES; index++)
+    {
+        const race_pace_result_t *result = &results[index];
+
+        if (0U == result->rounds)
+        {
+            continue;
+        }
+        (void)printf("  %7u %6u %10u %10u %6u\n", (unsigned)result->spec_id,
+                     (unsigned)result->rounds, (unsigned)result->work_us,
+                     (unsigned)result->max_work_us, (unsigned)result->missed);
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_freq_sweep_results
+********************************************************************************
+* Summary:
+* Prints the performance at each point of the frequency sweep, as DMIPS and
+* DMIPS/MHz of the CM33 clock.
+*
+* Parameters:
+*  results: Results of the CM33 image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_freq_sweep_results(const freq_sweep_result_t *results)
+{
+    static const char *const mode_names[] = { "hp", "lp", "ulp" };
+    uint32_t index;
+    float dmips;
+
+    (void)printf("frequency sweep\n");
+    (void)printf("  %4s %9s %8s %10s %10s %9s %9s\n", "mode", "dpll_mhz",
+                 "cpu_mhz", "iterations", "time_us", "dmips", "dmips/mhz");
+    for (index = 0U; index < FREQ_SWEEP_MAX_POINTS; index++)
+    {
+        const freq_sweep_result_t *result = &results[index];
+
+        if (0U == result->time_us)
+        {
+            continue;
+        }
+        dmips = ((float)result->iterations * 1000000.0f /
+                 (float)result->time_us) / DHRY_VAX_MIPS_DIVISOR;
+        (void)printf("  %4s %9u %8u %10u %10u %9.1f %9.3f\n",
+                     mode_names[result->system_mode],
+                     (unsigned)(result->dpll_freq_hz / 1000000U),
+                     (unsigned)(result->cpu_hz / 1000000U),
+                     (unsigned)result->iterations,
+                     (unsigned)result->time_us, dmips,
+                     dmips / ((float)result->cpu_hz / 1000000.0f));
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_hibernate_bench_results
+********************************************************************************
+* Summary:
+* Prints the Hibernate wakeup latencies and their histogram. On the host the
+* wakeup reset starts the runner again, so the latencies are those of the
+* process start.
+*
+* Parameters:
+*  results: Results of the CM33 image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_hibernate_bench_results(
+    const hibernate_bench_result_t *results)
+{
+    uint32_t index;
+
+    (void)printf("hibernate wakeups : %u\n", (unsigned)results->cycles);
+    if (0U == results->cycles)
+    {
+        return;
+    }
+    (void)printf("  %-8s %8s %8s %8s\n", "interval", "min_us", "mean_us",
+                 "max_us");
+    for (index = 0U; index < (uint32_t)HIBERNATE_INTERVAL_COUNT; index++)
+    {
+        const hibernate_interval_result_t *result = &results->intervals[index];
+
+        (void)printf("  %-8s %8u %8u %8u\n", result->name,
+                     (unsigned)result->min_us, (unsigned)result->mean_us,
+                     (unsigned)result->max_us);
+    }
+    for (index = 0U; index < HIBERNATE_BENCH_BUCKETS; index++)
+    {
+        (void)printf("  %s%5u us %8u\n",
+                     (index < (HIBERNATE_BENCH_BUCKETS - 1U)) ? "< " : ">=",
+                     (unsigned)(HIBERNATE_BENCH_BUCKET_US *
+                                ((index < (HIBERNATE_BENCH_BUCKETS - 1U)) ?
+                                 (index + 1U) : index)),
+                     (unsigned)results->histogram[index]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: write_event_trace
+********************************************************************************
+* Summary:
+* Writes the event trace logs of both cores and the backup registers to a
+* binary file, as a debugger would dump them from the device.
+*
+* Parameters:
+*  path: File to write
+*
+* Return:
+*  bool: false when the images have no event trace or the file cannot be
+*        written
+*
+*******************************************************************************/
+static bool write_event_trace(const char *path)
+{
+    uint32_t breg[EVENT_TRACE_BREG_WORDS];
+    FILE *file;
+    uint32_t index;
+    bool written;
+
+    if (NULL == &cm33_event_trace_log)
+    {
+        return false;
+    }
+
+    file = fopen(path, "wb");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    for (index = 0U; index < EVENT_TRACE_BREG_WORDS; index++)
+    {
+        breg[index] = EVENT_TRACE_BREG[index];
+    }
+
+    written = (1U == fwrite(&cm33_event_trace_log,
+                            sizeof(cm33_event_trace_log), 1U, file));
+    if (written && (EVENT_TRACE_MAGIC == cm55_event_trace_log.magic))
+    {
+        written = (1U == fwrite(&cm55_event_trace_log,
+                                sizeof(cm55_event_trace_log), 1U, file));
+    }
+    if (written && (EVENT_TRACE_BREG_MAGIC == (breg[0] >> 16)))
+    {
+        written = (1U == fwrite(breg, sizeof(breg), 1U, file));
+    }
+
+    return (0 == fclose(file)) && written;
+}
+
+/*******************************************************************************
+* Function Name: wait_run
+********************************************************************************
+* Summary:
+* Waits until the run stops or run_time_ms have passed. In a Hibernate
+* benchmark the boot after the last cycle also ends the run: the system then
+* stays in Deep Sleep, which is not part of the benchmark and would outweigh
+* the Hibernate time in the current estimate.
+*
+*******************************************************************************/
+static void wait_run(uint32_t run_time_ms)
+{
+#if defined(HIBERNATE_BENCH_CYCLES)
+    uint32_t waited_ms;
+
+    for (waited_ms = 0U; waited_ms < run_time_ms;
+         waited_ms += HIBERNATE_BENCH_POLL_MS)
+    {
+        if (host_wait_stop(HIBERNATE_BENCH_POLL_MS))
+        {
+            return;
+        }
+        if (cm33_hibernate_bench_results.cycles >= HIBERNATE_BENCH_CYCLES)
+        {
+            /* Lets the CM33 finish copying the results */
+            (void)host_wait_stop(HIBERNATE_BENCH_POLL_MS);
+            return;
+        }
+    }
+#else
+    (void)host_wait_stop(run_time_ms);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the application for the time given with "-t <ms>" and prints the SoC
+* state reached through the stand-in PDL. With "-m <file>" the output changes
+* of the GPIO pins, such as the phase markers, are written to a CSV file.
+* With "-c <file>" the current estimate uses the SPEC ID currents of the file,
+* one "<SPEC ID name> <uA>" pair per line, and "SRAM64K <uA>" for each SRAM
+* macro retained in SIDDSA. With "-e <file>" the event trace of images built
+* with EVENT_TRACE_ENABLE is written to a binary file.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, or EXIT_FAILURE on a bad command line or when the power
+*       model found an illegal sequence
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t run_time_ms = DEFAULT_RUN_TIME_MS;
+    const char *timeline_path = NULL;
+    const char *currents_path = NULL;
+    const char *trace_path = NULL;
+    uint32_t violations;
+    char audit_text[GATING_AUDIT_TEXT_LEN];
+    int index;
+
+    for (index = 1; index < argc; index++)
+    {
+        if ((0 == strcmp(argv[index], "-t")) && ((index + 1) < argc))
+        {
+            run_time_ms = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-m")) && ((index + 1) < argc))
+        {
+            timeline_path = argv[++index];
+        }
+        else if ((0 == strcmp(argv[index], "-c")) && ((index + 1) < argc))
+        {
+            currents_path = argv[++index];
+        }
+        else if ((0 == strcmp(argv[index], "-e")) && ((index + 1) < argc))
+        {
+            trace_path = argv[++index];
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-t run_time_ms] "
+                          "[-m timeline.csv] [-c currents.txt] "
+                          "[-e trace.bin]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    host_set_reset_argv(argv);
+    host_init();
+    /* Stands in for the secure image, which runs before the CM33 image */
+    hibernate_bench_mark_secure();
+    if ((NULL != currents_path) && !host_power_load_currents(currents_path))
+    {
+        (void)fprintf(stderr, "cannot read %s\n", currents_path);
+        return EXIT_FAILURE;
+    }
+    host_start_core(HOST_CORE_CM33, cm33_app_main);
+    wait_run(run_time_ms);
+
+    host_print_summary();
+    (void)cm33_gating_audit_format(&cm33_gating_audit, audit_text,
+                                   sizeof(audit_text));
+    (void)printf("gating audit      : %s\n", audit_text);
+    (void)printf("cm33 dhrystones   : %u\n", (unsigned)cm33_dhry_run_count);
+    (void)printf("cm55 dhrystones   : %u\n", (unsigned)cm55_dhry_run_count);
+    (void)printf("dhrystone code    : %s / %s\n", cm33_dhry_code_placement,
+                 cm55_dhry_code_placement);
+    if (NULL != &cm33_dhry_score)
+    {
+        print_dhry_score("cm33", &cm33_dhry_score);
+        print_dhry_score("cm55", &cm55_dhry_score);
+    }
+    if (NULL != &cm33_dhry_prof)
+    {
+        print_dhry_prof("cm33", &cm33_dhry_prof);
+        print_dhry_prof("cm55", &cm55_dhry_prof);
+    }
+    if (NULL != &cm33_transition_results)
+    {
+        print_transition_results(cm33_transition_results);
+    }
+    if (NULL != &cm33_ring_bench_results)
+    {
+        print_ring_bench_results(cm33_ring_bench_results);
+    }
+    if (NULL != &cm33_race_pace_results)
+    {
+        print_race_pace_results(cm33_race_pace_results);
+    }
+    if (NULL != &cm33_freq_sweep_results)
+    {
+        print_freq_sweep_results(cm33_freq_sweep_results);
+    }
+    if (NULL != &cm33_hibernate_bench_results)
+    {
+        print_hibernate_bench_results(&cm33_hibernate_bench_results);
+    }
+    (void)fflush(stdout);
+
+    if ((NULL != timeline_path) && !host_write_gpio_timeline(timeline_path))
+    {
+        (void)fprintf(stderr, "cannot write %s\n", timeline_path);
+        exit(EXIT_FAILURE);
+    }
+
+    if ((NULL != trace_path) && !write_event_trace(trace_path))
+    {
+        (void)fprintf(stderr, "cannot write %s\n", trace_path);
+        exit(EXIT_FAILURE);
+    }
+
+    host_lock();
+    violations = host_soc.violations;
+    host_unlock();
+
+    /* The core threads never return; end the process with them running */
+    exit((0U == violations) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,211 @@
+/*******************************************************************************
+* File Name        : marker_windows.c
+*
+* Description      : Cuts a marker pin timeline into phase windows. The input
+*                    is the CSV written by "power_host -m", or a digital
+*                    channel export of a power analyzer converted to the same
+*                    columns. The windows can be used to cut the current
+*                    trace of the same capture.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "marker.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define LINE_LENGTH                 (256U)
+
+/*******************************************************************************
+* Function Name: print_window
+********************************************************************************
+* Summary:
+* Prints one phase window as a CSV line. A window that is still open has no
+* end and no duration.
+*
+*******************************************************************************/
+static void print_window(unsigned long long start_us,
+                         unsigned long long end_us, bool open, unsigned code)
+{
+    if (open)
+    {
+        (void)printf("%llu,,,%u,", start_us, code);
+    }
+    else
+    {
+        (void)printf("%llu,%llu,%llu,%u,", start_us, end_us,
+                     end_us - start_us, code);
+    }
+    if (MARKER_CODE_TRANSITION == code)
+    {
+        (void)printf("transition\n");
+    }
+    else if (MARKER_CODE_WORK_DONE == code)
+    {
+        (void)printf("work_done\n");
+    }
+    else if (MARKER_CODE_SWEEP == code)
+    {
+        (void)printf("sweep\n");
+    }
+    else
+    {
+        (void)printf("spec_id %u\n", code);
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Reads "time_us,core,port,pin,level" lines from a file, or from stdin, and
+* prints "start_us,end_us,duration_us,code,phase" for every phase window.
+* The code of a window is the number of code pulses since the end of the
+* previous window.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, or EXIT_FAILURE on a bad command line or input
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    unsigned marker_port = 0U;
+    unsigned phase_pin = MARKER_PIN_PHASE;
+    unsigned code_pin = MARKER_PIN_CODE;
+    const char *path = NULL;
+    FILE *file = stdin;
+    char line[LINE_LENGTH];
+    unsigned long long time_us = 0U;
+    unsigned long long start_us = 0U;
+    unsigned code = 0U;
+    unsigned window_code = 0U;
+    int in_window = 0;
+    int index;
+
+    for (index = 1; index < argc; index++)
+    {
+        if ((0 == strcmp(argv[index], "-P")) && ((index + 1) < argc))
+        {
+            marker_port = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-p")) && ((index + 1) < argc))
+        {
+            phase_pin = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[index], "-c")) && ((index + 1) < argc))
+        {
+            code_pin = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((NULL == path) && ('-' != argv[index][0]))
+        {
+            path = argv[index];
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-P port] [-p phase_pin] "
+                          "[-c code_pin] [timeline.csv]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((NULL != path) && (NULL == (file = fopen(path, "r"))))
+    {
+        (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], path);
+        return EXIT_FAILURE;
+    }
+
+    (void)printf("start_us,end_us,duration_us,code,phase\n");
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        char core[16];
+        unsigned port;
+        unsigned pin;
+        unsigned level;
+
+        /* Skips the header and any line that is not an edge */
+        if (5 != sscanf(line, "%llu,%15[^,],%u,%u,%u", &time_us, core, &port,
+                        &pin, &level))
+        {
+            continue;
+        }
+
+        if (port != marker_port)
+        {
+            continue;
+        }
+
+        if ((pin == code_pin) && (1U == level) && !in_window)
+        {
+            code++;
+        }
+        else if ((pin == phase_pin) && (1U == level) && !in_window)
+        {
+            in_window = 1;
+            start_us = time_us;
+            window_code = code;
+            code = 0U;
+        }
+        else if ((pin == phase_pin) && (0U == level) && in_window)
+        {
+            in_window = 0;
+            print_window(start_us, time_us, false, window_code);
+        }
+        else
+        {
+            /* Iteration pins */
+        }
+    }
+
+    if (in_window)
+    {
+        print_window(start_us, 0U, true, window_code);
+    }
+
+    if (stdin != file)
+    {
+        (void)fclose(file);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
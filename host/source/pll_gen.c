@@ -0,0 +1,400 @@
+/*******************************************************************************
+* File Name        : pll_gen.c
+*
+* Description      : This file is a host tool that computes the DPLL-LP
+*                    settings of a list of frequencies, checks them against
+*                    the DPLL-LP limits and writes the table that the CM33
+*                    uses to switch frequency without computing dividers.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "specs.h"
+#include "dpll_lp_table.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MAX_SETTINGS                (128U)
+
+/* Largest accepted error of a fractional setting */
+#define MAX_ERROR_HZ                (1U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Copyright and license of the generated file */
+static const char *const license[] =
+{
+    "* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon",
+    "* Technologies AG. All rights reserved.",
+    "* This software, associated documentation and materials (\"Software\") is",
+    "* owned by Infineon Technologies AG or one of its affiliates (\"Infineon\")",
+    "* and is protected by and subject to worldwide patent protection, worldwide",
+    "* copyright laws, and international treaty provisions. Therefore, you may use",
+    "* this Software only as provided in the license agreement accompanying the",
+    "* software package from which you obtained this Software. If no license",
+    "* agreement applies, then any use, reproduction, modification, translation, or",
+    "* compilation of this Software is prohibited without the express written",
+    "* permission of Infineon.",
+    "*",
+    "* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE",
+    "* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,",
+    "* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF",
+    "* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A",
+    "* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.",
+    "* Infineon reserves the right to make changes to the Software without notice.",
+    "* You are responsible for properly designing, programming, and testing the",
+    "* functionality and safety of your intended application of the Software, as",
+    "* well as complying with any legal requirements related to its use. Infineon",
+    "* does not guarantee that the Software will be free from intrusion, data theft",
+    "* or loss, or other breaches (\"Security Breaches\"), and Infineon shall have",
+    "* no liability arising out of any Security Breaches. Unless otherwise",
+    "* explicitly approved by Infineon, the Software may not be used in any",
+    "* application where a failure of the Product or any consequences of the use",
+    "* thereof can reasonably be expected to result in personal injury.",
+};
+
+/*******************************************************************************
+* Function Name: better
+********************************************************************************
+* Summary:
+* Returns true if a candidate setting is preferred to the best one so far:
+* the smaller error first, then integer mode (no fractional spurs), then the
+* higher comparison frequency (lower jitter), then the lower DCO frequency
+* (lower current).
+*
+*******************************************************************************/
+static bool better(const dpll_lp_setting_t *candidate, uint32_t error,
+                   const dpll_lp_setting_t *best, uint32_t best_error)
+{
+    if (error != best_error)
+    {
+        return error < best_error;
+    }
+    if ((0U == candidate->frac_div) != (0U == best->frac_div))
+    {
+        return 0U == candidate->frac_div;
+    }
+    if (candidate->reference_div != best->reference_div)
+    {
+        return candidate->reference_div < best->reference_div;
+    }
+    return candidate->output_div < best->output_div;
+}
+
+/*******************************************************************************
+* Function Name: solve
+********************************************************************************
+* Summary:
+* Searches every reference and output divider within the DPLL-LP limits for
+* the setting closest to a frequency.
+*
+* Parameters:
+*  input_hz: Reference input frequency
+*  freq_hz: Output frequency
+*  setting: Best setting
+*
+* Return:
+*  bool: false if no setting is within MAX_ERROR_HZ
+*
+*******************************************************************************/
+static bool solve(uint32_t input_hz, uint32_t freq_hz,
+                  dpll_lp_setting_t *setting)
+{
+    dpll_lp_setting_t candidate;
+    uint32_t best_error = UINT32_MAX;
+    uint32_t error;
+    uint32_t actual_hz;
+    uint32_t ref_div;
+    uint32_t out_div;
+    uint64_t dco_hz;
+    uint64_t feedback;
+
+    for (ref_div = DPLL_LP_MIN_REF_DIV; ref_div <= DPLL_LP_MAX_REF_DIV;
+         ref_div++)
+    {
+        if (((input_hz / ref_div) < DPLL_LP_MIN_PFD_HZ) ||
+            ((input_hz / ref_div) > DPLL_LP_MAX_PFD_HZ))
+        {
+            continue;
+        }
+
+        for (out_div = DPLL_LP_MIN_OUT_DIV; out_div <= DPLL_LP_MAX_OUT_DIV;
+             out_div++)
+        {
+            dco_hz = (uint64_t)freq_hz * out_div;
+            if ((dco_hz < DPLL_LP_MIN_DCO_HZ) || (dco_hz > DPLL_LP_MAX_DCO_HZ))
+            {
+                continue;
+            }
+
+            /* Feedback divider in 2^-24 steps, rounded */
+            feedback = (((dco_hz * ref_div) << DPLL_LP_FRAC_BITS) +
+                        (input_hz / 2U)) / input_hz;
+            if ((feedback < ((uint64_t)DPLL_LP_MIN_FB_DIV <<
+                             DPLL_LP_FRAC_BITS)) ||
+                (feedback > ((uint64_t)DPLL_LP_MAX_FB_DIV <<
+                             DPLL_LP_FRAC_BITS)))
+            {
+                continue;
+            }
+
+            candidate.freq_hz = freq_hz;
+            candidate.feedback_div = (uint8_t)(feedback >> DPLL_LP_FRAC_BITS);
+            candidate.reference_div = (uint8_t)ref_div;
+            candidate.output_div = (uint8_t)out_div;
+            candidate.frac_div = (uint32_t)(feedback &
+                                 ((1U << DPLL_LP_FRAC_BITS) - 1U));
+
+            actual_hz = dpll_lp_setting_freq_hz(input_hz, &candidate);
+            error = (actual_hz > freq_hz) ? (actual_hz - freq_hz) :
+                                            (freq_hz - actual_hz);
+            if ((UINT32_MAX == best_error) ||
+                better(&candidate, error, setting, best_error))
+            {
+                *setting = candidate;
+                best_error = error;
+            }
+        }
+    }
+
+    return best_error <= MAX_ERROR_HZ;
+}
+
+/*******************************************************************************
+* Function Name: parse_freqs
+********************************************************************************
+* Summary:
+* Reads a comma-separated list of frequencies in hertz and adds them to the
+* list. Returns false on a malformed list or too many frequencies.
+*
+*******************************************************************************/
+static bool parse_freqs(const char *text, uint32_t *freqs, uint32_t *count)
+{
+    char *end;
+
+    while (*count < MAX_SETTINGS)
+    {
+        freqs[(*count)++] = (uint32_t)strtoul(text, &end, 0);
+        if (',' != *end)
+        {
+            return ('\0' == *end) && (end != text);
+        }
+        text = end + 1;
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: compare_freq
+********************************************************************************
+* Summary:
+* Orders frequencies for qsort().
+*
+*******************************************************************************/
+static int compare_freq(const void *left, const void *right)
+{
+    uint32_t a = *(const uint32_t *)left;
+    uint32_t b = *(const uint32_t *)right;
+
+    return (a > b) - (a < b);
+}
+
+/*******************************************************************************
+* Function Name: write_table
+********************************************************************************
+* Summary:
+* Writes the C source of the table.
+*
+*******************************************************************************/
+static void write_table(FILE *file, uint32_t input_hz,
+                        const dpll_lp_setting_t *settings, uint32_t count)
+{
+    uint32_t index;
+
+    (void)fprintf(file,
+        "/*****************************************************************"
+        "**************\n"
+        "* File Name        : dpll_lp_table.c\n"
+        "*\n"
+        "* Description      : This file holds the precomputed DPLL-LP "
+        "settings. It is\n"
+        "*                    generated by host/build/pll_gen; run "
+        "\"make -C host\n"
+        "*                    pll_table\" instead of editing it.\n"
+        "*\n"
+        "* Related Document : See README.md\n"
+        "*\n");
+    for (index = 0U; index < (sizeof(license) / sizeof(license[0])); index++)
+    {
+        (void)fprintf(file, "%s\n", license[index]);
+    }
+    (void)fprintf(file,
+        "*****************************************************************"
+        "**************/\n\n"
+        "/*****************************************************************"
+        "**************\n"
+        "* Header Files\n"
+        "*****************************************************************"
+        "**************/\n"
+        "#include \"cybsp.h\"\n"
+        "#include \"specs.h\"\n"
+        "#include \"dpll_lp_table.h\"\n\n"
+        "#if (DPLL_INTPUT_FREQ_HZ != %uU)\n"
+        "#error \"The DPLL-LP table was generated for another input "
+        "frequency\"\n"
+        "#endif\n\n"
+        "/*****************************************************************"
+        "**************\n"
+        "* Global Variables\n"
+        "*****************************************************************"
+        "**************/\n"
+        "/* Columns: output Hz, feedback, reference and output dividers, "
+        "fraction */\n"
+        "const dpll_lp_setting_t dpll_lp_table[] =\n"
+        "{\n", (unsigned)input_hz);
+
+    for (index = 0U; index < count; index++)
+    {
+        (void)fprintf(file, "    { %uU, %uU, %uU, %uU, %uU }%s\n",
+                      (unsigned)settings[index].freq_hz,
+                      (unsigned)settings[index].feedback_div,
+                      (unsigned)settings[index].reference_div,
+                      (unsigned)settings[index].output_div,
+                      (unsigned)settings[index].frac_div,
+                      ((index + 1U) < count) ? "," : "");
+    }
+
+    (void)fprintf(file,
+        "};\n\n"
+        "const uint32_t dpll_lp_table_count =\n"
+        "    sizeof(dpll_lp_table) / sizeof(dpll_lp_table[0]);\n\n"
+        "/* [] END OF FILE */\n");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Computes the DPLL-LP setting of each frequency of the command line and
+* writes the table to a file, or to stdout. Fails without writing if a
+* frequency has no setting within the limits or appears twice.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, or EXIT_FAILURE on a bad command line or frequency
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    static uint32_t freqs[MAX_SETTINGS];
+    static dpll_lp_setting_t settings[MAX_SETTINGS];
+    uint32_t input_hz = DPLL_INTPUT_FREQ_HZ;
+    uint32_t count = 0U;
+    const char *path = NULL;
+    FILE *file = stdout;
+    uint32_t index;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((0 == strcmp(argv[arg], "-i")) && ((arg + 1) < argc))
+        {
+            input_hz = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[arg], "-o")) && ((arg + 1) < argc))
+        {
+            path = argv[++arg];
+        }
+        else if (('-' != argv[arg][0]) && parse_freqs(argv[arg], freqs, &count))
+        {
+            /* Frequencies added */
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-i input_hz] [-o table.c] "
+                          "freq_hz[,freq_hz...]...\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((0U == count) || (0U == input_hz))
+    {
+        (void)fprintf(stderr, "%s: no frequencies\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    qsort(freqs, count, sizeof(freqs[0]), compare_freq);
+    for (index = 0U; index < count; index++)
+    {
+        if ((index > 0U) && (freqs[index] == freqs[index - 1U]))
+        {
+            (void)fprintf(stderr, "%s: %u Hz listed twice\n", argv[0],
+                          (unsigned)freqs[index]);
+            return EXIT_FAILURE;
+        }
+        if (!solve(input_hz, freqs[index], &settings[index]))
+        {
+            (void)fprintf(stderr, "%s: no DPLL-LP setting for %u Hz\n",
+                          argv[0], (unsigned)freqs[index]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((NULL != path) && (NULL == (file = fopen(path, "w"))))
+    {
+        (void)fprintf(stderr, "%s: cannot create %s\n", argv[0], path);
+        return EXIT_FAILURE;
+    }
+
+    write_table(file, input_hz, settings, count);
+
+    if (stdout != file)
+    {
+        (void)fclose(file);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
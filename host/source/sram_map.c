@@ -0,0 +1,423 @@
+/*******************************************************************************
+* File Name        : sram_map.c
+*
+* Description      : Reads the GNU ld linker maps of the images and writes
+*                    the table of the SRAM macros and SOCMEM partitions that
+*                    hold a section of any of them (sram_retention_used). The
+*                    firmware powers the others down with SRAM_MAP_POWER_DOWN.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sram_retention.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define LINE_LEN                    (512U)
+#define MAX_BLOCKS                  (32U)
+
+/* Line of the map after which the output sections are listed */
+#define MEMORY_MAP_TITLE            "Linker script and memory map"
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Memory powered in blocks of one size: an SRAM or the SOCMEM */
+typedef struct
+{
+    const char *name;
+    uint32_t base;
+    uint32_t blocks;
+    uint32_t block_size;
+} region_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const region_t regions[] =
+{
+    { "sram0", SRAM_RETENTION_BASE, SRAM_RETENTION_MACROS,
+      SRAM_RETENTION_MACRO_SIZE },
+    { "sram1", SRAM_RETENTION_BASE +
+      (SRAM_RETENTION_MACROS * SRAM_RETENTION_MACRO_SIZE),
+      SRAM_RETENTION_MACROS, SRAM_RETENTION_MACRO_SIZE },
+    { "socmem", SRAM_RETENTION_SOCMEM_BASE, SRAM_RETENTION_SOCMEM_PARTITIONS,
+      SRAM_RETENTION_PARTITION_SIZE }
+};
+
+#define REGION_COUNT                (sizeof(regions) / sizeof(regions[0]))
+#define REGION_SOCMEM               (2U)
+
+/* Bytes of the sections in each block */
+static uint64_t used_bytes[REGION_COUNT][MAX_BLOCKS];
+
+/* Copyright and license of the generated file */
+static const char *const license[] =
+{
+    "* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon",
+    "* Technologies AG. All rights reserved.",
+    "* This software, associated documentation and materials (\"Software\") is",
+    "* owned by Infineon Technologies AG or one of its affiliates (\"Infineon\")",
+    "* and is protected by and subject to worldwide patent protection, worldwide",
+    "* copyright laws, and international treaty provisions. Therefore, you may use",
+    "* this Software only as provided in the license agreement accompanying the",
+    "* software package from which you obtained this Software. If no license",
+    "* agreement applies, then any use, reproduction, modification, translation, or",
+    "* compilation of this Software is prohibited without the express written",
+    "* permission of Infineon.",
+    "*",
+    "* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE",
+    "* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,",
+    "* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF",
+    "* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A",
+    "* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.",
+    "* Infineon reserves the right to make changes to the Software without notice.",
+    "* You are responsible for properly designing, programming, and testing the",
+    "* functionality and safety of your intended application of the Software, as",
+    "* well as complying with any legal requirements related to its use. Infineon",
+    "* does not guarantee that the Software will be free from intrusion, data theft",
+    "* or loss, or other breaches (\"Security Breaches\"), and Infineon shall have",
+    "* no liability arising out of any Security Breaches. Unless otherwise",
+    "* explicitly approved by Infineon, the Software may not be used in any",
+    "* application where a failure of the Product or any consequences of the use",
+    "* thereof can reasonably be expected to result in personal injury.",
+};
+
+/*******************************************************************************
+* Function Name: add_section
+********************************************************************************
+* Summary:
+* Adds the bytes of a section to the blocks it overlaps. Secure aliases count
+* as the memory they alias; sections outside the regions are ignored.
+*
+*******************************************************************************/
+static void add_section(uint64_t address, uint64_t size)
+{
+    const region_t *region;
+    uint64_t block_start;
+    uint64_t start;
+    uint64_t end;
+    uint32_t index;
+    uint32_t block;
+
+    address &= ~(uint64_t)SRAM_RETENTION_SECURE_ALIAS;
+    for (index = 0U; index < REGION_COUNT; index++)
+    {
+        region = &regions[index];
+        for (block = 0U; block < region->blocks; block++)
+        {
+            block_start = region->base +
+                          ((uint64_t)block * region->block_size);
+            start = (address > block_start) ? address : block_start;
+            end = address + size;
+            if (end > (block_start + region->block_size))
+            {
+                end = block_start + region->block_size;
+            }
+            if (end > start)
+            {
+                used_bytes[index][block] += end - start;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: read_map
+********************************************************************************
+* Summary:
+* Adds the output sections of a GNU ld map file. An output section starts in
+* the first column with its name, followed by its address and size on the
+* same line, or on the next line when the name is long.
+*
+*******************************************************************************/
+static bool read_map(const char *path)
+{
+    char line[LINE_LEN];
+    char name[LINE_LEN];
+    unsigned long long address;
+    unsigned long long size;
+    bool in_map = false;
+    bool pending = false;
+    FILE *file;
+    int fields;
+
+    file = fopen(path, "r");
+    if (NULL == file)
+    {
+        return false;
+    }
+
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        if (!in_map)
+        {
+            in_map = (0 == strncmp(line, MEMORY_MAP_TITLE,
+                                   strlen(MEMORY_MAP_TITLE)));
+            continue;
+        }
+
+        if (pending)
+        {
+            pending = false;
+            if (2 == sscanf(line, " 0x%llx 0x%llx", &address, &size))
+            {
+                add_section(address, size);
+            }
+            continue;
+        }
+
+        if ('.' != line[0])
+        {
+            continue;
+        }
+
+        fields = sscanf(line, "%s 0x%llx 0x%llx", name, &address, &size);
+        if (3 == fields)
+        {
+            add_section(address, size);
+        }
+        else if (1 == fields)
+        {
+            pending = true;
+        }
+    }
+
+    (void)fclose(file);
+
+    return in_map;
+}
+
+/*******************************************************************************
+* Function Name: used_mask
+********************************************************************************
+* Summary:
+* Returns the blocks of a region that hold any section; all blocks when no
+* map was read.
+*
+*******************************************************************************/
+static uint32_t used_mask(uint32_t region, bool maps_read)
+{
+    uint32_t mask = 0U;
+    uint32_t block;
+
+    for (block = 0U; block < regions[region].blocks; block++)
+    {
+        if (!maps_read || (0U != used_bytes[region][block]))
+        {
+            mask |= 1UL << block;
+        }
+    }
+
+    return mask;
+}
+
+/*******************************************************************************
+* Function Name: write_table
+********************************************************************************
+* Summary:
+* Writes the C source of the table.
+*
+*******************************************************************************/
+static void write_table(FILE *file, char *maps[], uint32_t map_count)
+{
+    uint32_t index;
+
+    (void)fprintf(file,
+        "/*****************************************************************"
+        "**************\n"
+        "* File Name        : sram_map_table.c\n"
+        "*\n"
+        "* Description      : This file holds the SRAM and SOCMEM used by "
+        "the images. It\n"
+        "*                    is generated by host/build/sram_map from their "
+        "linker\n"
+        "*                    maps; run \"make -C host sram_table\" instead "
+        "of editing it.\n"
+        "*\n"
+        "* Related Document : See README.md\n"
+        "*\n");
+    for (index = 0U; index < (sizeof(license) / sizeof(license[0])); index++)
+    {
+        (void)fprintf(file, "%s\n", license[index]);
+    }
+    (void)fprintf(file,
+        "*****************************************************************"
+        "**************/\n\n"
+        "/*****************************************************************"
+        "**************\n"
+        "* Header Files\n"
+        "*****************************************************************"
+        "**************/\n"
+        "#include \"sram_retention.h\"\n\n"
+        "/*****************************************************************"
+        "**************\n"
+        "* Global Variables\n"
+        "*****************************************************************"
+        "**************/\n");
+    if (0U == map_count)
+    {
+        (void)fprintf(file, "/* No linker map was read: all memory is "
+                      "used */\n");
+    }
+    else
+    {
+        (void)fprintf(file, "/* Memory used by:\n");
+        for (index = 0U; index < map_count; index++)
+        {
+            (void)fprintf(file, " *  %s\n", maps[index]);
+        }
+        (void)fprintf(file, " */\n");
+    }
+    (void)fprintf(file,
+        "const sram_retention_t sram_retention_used =\n"
+        "{\n"
+        "    .retained = { 0x%02XU, 0x%02XU },\n"
+        "    .socmem_retained = 0x%03XU\n"
+        "};\n\n"
+        "/* [] END OF FILE */\n",
+        (unsigned)used_mask(0U, 0U != map_count),
+        (unsigned)used_mask(1U, 0U != map_count),
+        (unsigned)used_mask(REGION_SOCMEM, 0U != map_count));
+}
+
+/*******************************************************************************
+* Function Name: print_usage
+********************************************************************************
+* Summary:
+* Prints the bytes used in each block that holds a section and the masks of
+* the table, to stderr.
+*
+*******************************************************************************/
+static void print_usage(bool maps_read)
+{
+    uint32_t index;
+    uint32_t block;
+
+    for (index = 0U; index < REGION_COUNT; index++)
+    {
+        for (block = 0U; block < regions[index].blocks; block++)
+        {
+            if (0U != used_bytes[index][block])
+            {
+                (void)fprintf(stderr, "%-6s %2u 0x%08x %8llu bytes\n",
+                              regions[index].name, (unsigned)block,
+                              (unsigned)(regions[index].base +
+                                         (block * regions[index].block_size)),
+                              (unsigned long long)used_bytes[index][block]);
+            }
+        }
+    }
+    (void)fprintf(stderr, "used   sram0 0x%02X sram1 0x%02X socmem 0x%03X\n",
+                  (unsigned)used_mask(0U, maps_read),
+                  (unsigned)used_mask(1U, maps_read),
+                  (unsigned)used_mask(REGION_SOCMEM, maps_read));
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Reads the linker maps of the command line and writes the table to a file,
+* or to stdout, and the bytes used per block to stderr. Without maps, the
+* table keeps all memory powered.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, or EXIT_FAILURE on a bad command line or map
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    static char *maps[64];
+    uint32_t map_count = 0U;
+    const char *path = NULL;
+    FILE *file = stdout;
+    uint32_t index;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((0 == strcmp(argv[arg], "-o")) && ((arg + 1) < argc))
+        {
+            path = argv[++arg];
+        }
+        else if (('-' != argv[arg][0]) &&
+                 (map_count < (sizeof(maps) / sizeof(maps[0]))))
+        {
+            maps[map_count++] = argv[arg];
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [-o table.c] [image.map]...\n",
+                          argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (index = 0U; index < map_count; index++)
+    {
+        if (!read_map(maps[index]))
+        {
+            (void)fprintf(stderr, "%s: %s is not a GNU ld map file\n",
+                          argv[0], maps[index]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((NULL != path) && (NULL == (file = fopen(path, "w"))))
+    {
+        (void)fprintf(stderr, "%s: cannot create %s\n", argv[0], path);
+        return EXIT_FAILURE;
+    }
+
+    write_table(file, maps, map_count);
+    print_usage(0U != map_count);
+
+    if (stdout != file)
+    {
+        (void)fclose(file);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* File Name        : dpll_lp_table.c
+*
+* Description      : This file holds the precomputed DPLL-LP settings. It is
+*                    generated by host/build/pll_gen; run "make -C host
+*                    pll_table" instead of editing it.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "dpll_lp_table.h"
+
+#if (DPLL_INTPUT_FREQ_HZ != 50000000U)
+#error "The DPLL-LP table was generated for another input frequency"
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Columns: output Hz, feedback, reference and output dividers, fraction */
+const dpll_lp_setting_t dpll_lp_table[] =
+{
+    { 50000000U, 56U, 7U, 8U, 0U },
+    { 60000000U, 84U, 7U, 10U, 0U },
+    { 70000000U, 98U, 7U, 10U, 0U },
+    { 80000000U, 56U, 7U, 5U, 0U },
+    { 90000000U, 63U, 7U, 5U, 0U },
+    { 100000000U, 56U, 7U, 4U, 0U },
+    { 110000000U, 77U, 7U, 5U, 0U },
+    { 120000000U, 84U, 7U, 5U, 0U },
+    { 130000000U, 91U, 7U, 5U, 0U },
+    { 140000000U, 98U, 7U, 5U, 0U },
+    { 150000000U, 63U, 7U, 3U, 0U },
+    { 160000000U, 112U, 7U, 5U, 0U },
+    { 170000000U, 102U, 10U, 3U, 0U },
+    { 180000000U, 108U, 10U, 3U, 0U },
+    { 190000000U, 114U, 10U, 3U, 0U },
+    { 200000000U, 56U, 7U, 2U, 0U },
+    { 210000000U, 84U, 10U, 2U, 0U },
+    { 220000000U, 88U, 10U, 2U, 0U },
+    { 230000000U, 92U, 10U, 2U, 0U },
+    { 240000000U, 96U, 10U, 2U, 0U },
+    { 250000000U, 70U, 7U, 2U, 0U },
+    { 260000000U, 104U, 10U, 2U, 0U },
+    { 270000000U, 108U, 10U, 2U, 0U },
+    { 280000000U, 112U, 10U, 2U, 0U },
+    { 290000000U, 116U, 10U, 2U, 0U },
+    { 300000000U, 84U, 7U, 2U, 0U },
+    { 310000000U, 124U, 10U, 2U, 0U },
+    { 320000000U, 128U, 10U, 2U, 0U },
+    { 330000000U, 132U, 10U, 2U, 0U },
+    { 340000000U, 136U, 10U, 2U, 0U },
+    { 350000000U, 98U, 7U, 2U, 0U },
+    { 360000000U, 144U, 10U, 2U, 0U },
+    { 370000000U, 148U, 10U, 2U, 0U },
+    { 380000000U, 152U, 10U, 2U, 0U },
+    { 390000000U, 156U, 10U, 2U, 0U },
+    { 400000000U, 56U, 7U, 1U, 0U }
+};
+
+const uint32_t dpll_lp_table_count =
+    sizeof(dpll_lp_table) / sizeof(dpll_lp_table[0]);
+
+/* [] END OF FILE */
@@ -0,0 +1,257 @@
+/*******************************************************************************
+* File Name        : dvfs.c
+*
+* Description      : This file implements the DVFS workload of the CM33. Each
+*                    window runs the work of a load trace, measures the busy
+*                    time and lets the DVFS governor pick the power profile
+*                    of the next window.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "cycle_counter.h"
+#include "lp_timer.h"
+#include "power_mode.h"
+#include "dvfs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CLK_HF path frequency with the DPLL-LP off */
+#define IHO_FREQ_HZ                 (50000000U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void dvfs_init(void);
+static void dvfs_run(void);
+static void dvfs_teardown(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+volatile uint32_t dvfs_windows;
+volatile uint32_t dvfs_transitions;
+volatile uint32_t dvfs_overruns;
+volatile uint32_t dvfs_level_windows[DVFS_GOVERNOR_MAX_LEVELS];
+
+const workload_t dvfs_workload =
+{
+    "dvfs", dvfs_init, dvfs_run, dvfs_teardown
+};
+
+/* Operating points, slowest first, and the steps of each window */
+static const uint32_t level_spec_ids[] = { DVFS_SPEC_IDS };
+static const uint32_t load_trace[] = { DVFS_LOAD_TRACE };
+
+#define DVFS_LEVEL_COUNT \
+    (sizeof(level_spec_ids) / sizeof(level_spec_ids[0]))
+#define DVFS_TRACE_LENGTH \
+    (sizeof(load_trace) / sizeof(load_trace[0]))
+
+static const power_profile_t *level_profiles[DVFS_GOVERNOR_MAX_LEVELS];
+static uint32_t level_capacity[DVFS_GOVERNOR_MAX_LEVELS];
+static dvfs_governor_t governor;
+static const workload_t *trace_workload;
+static uint32_t cpu_hz;
+static uint32_t next_window_tick;
+
+/*******************************************************************************
+* Function Name: cm33_freq_hz
+********************************************************************************
+* Summary:
+* Returns the CM33 (CLK_HF0) frequency that a profile sets.
+*
+*******************************************************************************/
+static uint32_t cm33_freq_hz(const power_profile_t *profile)
+{
+    uint32_t path_hz = (0U == profile->dpll_freq_hz) ?
+                       IHO_FREQ_HZ : profile->dpll_freq_hz;
+
+    return path_hz / ((uint32_t)profile->hf0_divider + 1U);
+}
+
+/*******************************************************************************
+* Function Name: set_level
+********************************************************************************
+* Summary:
+* Moves the system power mode and clocks to an operating point.
+*
+*******************************************************************************/
+static void set_level(uint32_t level)
+{
+    power_mode_scale(level_profiles[level]);
+    cpu_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+}
+
+/*******************************************************************************
+* Function Name: dvfs_init
+********************************************************************************
+* Summary:
+* Builds the operating points from DVFS_SPEC_IDS, with the CM33 frequency as
+* capacity. The first window runs at the fastest one so that the first
+* windows cannot miss their work. The window timer is started last.
+*
+*******************************************************************************/
+static void dvfs_init(void)
+{
+    dvfs_governor_config_t config;
+    uint32_t level;
+
+    if (DVFS_LEVEL_COUNT > DVFS_GOVERNOR_MAX_LEVELS)
+    {
+        handle_app_error();
+    }
+
+    for (level = 0U; level < DVFS_LEVEL_COUNT; level++)
+    {
+        level_profiles[level] = power_profile_find(level_spec_ids[level]);
+        if (NULL == level_profiles[level])
+        {
+            handle_app_error();
+        }
+        level_capacity[level] = cm33_freq_hz(level_profiles[level]);
+        dvfs_level_windows[level] = 0U;
+    }
+
+    config.levels = DVFS_LEVEL_COUNT;
+    config.capacity = level_capacity;
+    config.up_permille = DVFS_UP_PERMILLE;
+    config.down_permille = DVFS_DOWN_PERMILLE;
+    config.up_windows = DVFS_UP_WINDOWS;
+    config.down_windows = DVFS_DOWN_WINDOWS;
+
+    trace_workload = workload_find(DVFS_WORKLOAD);
+    if ((NULL == trace_workload) || (&dvfs_workload == trace_workload) ||
+        !dvfs_governor_init(&governor, &config, config.levels - 1U))
+    {
+        handle_app_error();
+    }
+
+    if (NULL != trace_workload->init)
+    {
+        trace_workload->init();
+    }
+
+    dvfs_windows = 0U;
+    dvfs_transitions = 0U;
+    dvfs_overruns = 0U;
+    next_window_tick = 0U;
+    lp_timer_start(DVFS_WINDOW_MS);
+}
+
+/*******************************************************************************
+* Function Name: dvfs_run
+********************************************************************************
+* Summary:
+* Runs one window: the steps of the load trace, then CPU Sleep until the
+* timer tick that ends the window. The busy time over the window length is
+* the load given to the governor. Work that ends after the tick is an
+* overrun and counts as a full window; the next window then starts at once.
+* The first window sets the starting operating point, after the transition
+* to the applied profile has ended.
+*
+*******************************************************************************/
+static void dvfs_run(void)
+{
+    uint32_t steps = load_trace[dvfs_windows % DVFS_TRACE_LENGTH];
+    uint32_t begin;
+    uint32_t busy_us;
+    uint32_t load_permille;
+    uint32_t level;
+    uint32_t step;
+
+    if (0U == dvfs_windows)
+    {
+        set_level(governor.level);
+    }
+
+    begin = cycle_counter_read();
+
+    for (step = 0U; step < steps; step++)
+    {
+        trace_workload->run();
+    }
+    busy_us = cycle_counter_to_us(cycle_counter_read() - begin, cpu_hz);
+
+    dvfs_level_windows[governor.level]++;
+    dvfs_windows++;
+
+    next_window_tick++;
+    if ((int32_t)(lp_timer_ticks() - next_window_tick) >= 0)
+    {
+        dvfs_overruns++;
+        next_window_tick = lp_timer_ticks();
+        load_permille = DVFS_GOVERNOR_FULL_LOAD;
+    }
+    else
+    {
+        load_permille = busy_us / DVFS_WINDOW_MS;
+    }
+
+    level = governor.level;
+    if (level != dvfs_governor_update(&governor, load_permille))
+    {
+        set_level(governor.level);
+        dvfs_transitions++;
+    }
+
+    while ((int32_t)(lp_timer_ticks() - next_window_tick) < 0)
+    {
+        (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+    }
+}
+
+/*******************************************************************************
+* Function Name: dvfs_teardown
+********************************************************************************
+* Summary:
+* Stops the timer and returns to the clocks of the applied profile.
+*
+*******************************************************************************/
+static void dvfs_teardown(void)
+{
+    lp_timer_stop();
+
+    if (NULL != trace_workload->teardown)
+    {
+        trace_workload->teardown();
+    }
+
+    power_mode_scale(power_mode_current());
+}
+
+/* [] END OF FILE */
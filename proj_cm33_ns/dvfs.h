@@ -0,0 +1,62 @@
+/*******************************************************************************
+* File Name        : dvfs.h
+*
+* Description      : This file provides the DVFS workload of the CM33. It
+*                    runs a load trace and moves the system between power
+*                    profiles with the DVFS governor.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DVFS_H
+#define DVFS_H
+
+#include <stdint.h>
+#include "dvfs_governor.h"
+#include "workload.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Windows run, operating point changes, and windows whose work did not fit
+ * in the window */
+extern volatile uint32_t dvfs_windows;
+extern volatile uint32_t dvfs_transitions;
+extern volatile uint32_t dvfs_overruns;
+
+/* Windows run at each operating point of DVFS_SPEC_IDS */
+extern volatile uint32_t dvfs_level_windows[DVFS_GOVERNOR_MAX_LEVELS];
+
+extern const workload_t dvfs_workload;
+
+#endif /* DVFS_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,261 @@
+/*******************************************************************************
+* File Name        : freq_sweep.c
+*
+* Description      : This file implements the DPLL-LP frequency sweep. For
+*                    each system power mode and each frequency that the mode
+*                    allows, the CM33 runs Dhrystone for a fixed window
+*                    and records the iterations. Each window is a marker
+*                    phase, so the current trace can be cut into the same
+*                    points. It is empty unless FREQ_SWEEP_DWELL_MS is
+*                    defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "cybsp.h"
+#include "specs.h"
+#include "cycle_counter.h"
+#include "dhry.h"
+#include "lp_timer.h"
+#include "marker.h"
+#include "workload.h"
+#include "power_mode.h"
+#include "freq_sweep.h"
+
+#if defined(FREQ_SWEEP_DWELL_MS)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CLK_HF path frequency with the DPLL-LP off */
+#define IHO_FREQ_HZ                 (50000000U)
+
+/* The points count the iterations in dhry_run_count, which no other workload
+ * advances, so the sweep always runs Dhrystone */
+#if defined(FREQ_SWEEP_WORKLOAD)
+#error "The frequency sweep runs the dhrystone workload only"
+#endif
+#define FREQ_SWEEP_WORKLOAD         "dhrystone"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+freq_sweep_result_t freq_sweep_results[FREQ_SWEEP_MAX_POINTS];
+
+/* Profiles of the points. power_mode_scale() keeps a pointer to the last
+ * one, so two are used in turn. */
+static power_profile_t points[2];
+
+/*******************************************************************************
+* Function Name: path_freq_hz
+********************************************************************************
+* Summary:
+* Returns the frequency of the DPLL-LP clock path: the DPLL-LP output, or the
+* IHO when the DPLL-LP is off.
+*
+*******************************************************************************/
+static uint32_t path_freq_hz(uint32_t dpll_freq_hz)
+{
+    return (0U == dpll_freq_hz) ? IHO_FREQ_HZ : dpll_freq_hz;
+}
+
+/*******************************************************************************
+* Function Name: mode_reference
+********************************************************************************
+* Summary:
+* Returns the profile of the power profile table with the fastest clocks in a
+* system power mode. Its clocks are the limit of the mode, and its CLK_HF
+* dividers are used for every point of the mode.
+*
+*******************************************************************************/
+static const power_profile_t *mode_reference(power_system_mode_t mode)
+{
+    const power_profile_t *reference = NULL;
+    const power_profile_t *profile;
+    uint32_t index;
+
+    for (index = 0U; index < power_profile_count(); index++)
+    {
+        profile = power_profile_get(index);
+        if ((profile->system_mode == mode) && (CUSTOM != profile->spec_id) &&
+            ((NULL == reference) ||
+             (path_freq_hz(profile->dpll_freq_hz) >
+              path_freq_hz(reference->dpll_freq_hz))))
+        {
+            reference = profile;
+        }
+    }
+
+    return reference;
+}
+
+/*******************************************************************************
+* Function Name: point_allowed
+********************************************************************************
+* Summary:
+* Returns true if a DPLL-LP frequency is allowed in the mode of a reference
+* profile: the path frequency must not exceed that of the reference, and a
+* mode whose reference runs from the IHO keeps the DPLL-LP off.
+*
+*******************************************************************************/
+static bool point_allowed(const power_profile_t *reference,
+                          uint32_t dpll_freq_hz)
+{
+    if ((0U != dpll_freq_hz) && (0U == reference->dpll_freq_hz))
+    {
+        return false;
+    }
+
+    return path_freq_hz(dpll_freq_hz) <=
+           path_freq_hz(reference->dpll_freq_hz);
+}
+
+/*******************************************************************************
+* Function Name: run_point
+********************************************************************************
+* Summary:
+* Moves to the clocks of a point and runs Dhrystone for FREQ_SWEEP_DWELL_MS.
+* The window is a MARKER_CODE_SWEEP phase.
+*
+*******************************************************************************/
+static void run_point(const workload_t *work, const power_profile_t *point,
+                      freq_sweep_result_t *result)
+{
+    uint32_t count;
+    uint32_t begin;
+
+    power_mode_scale(point);
+
+    result->system_mode = point->system_mode;
+    result->dpll_freq_hz = point->dpll_freq_hz;
+    result->cpu_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+
+    count = dhry_run_count;
+    begin = cycle_counter_read();
+    lp_timer_wait_ms(FREQ_SWEEP_DWELL_MS, work->run);
+    result->time_us = cycle_counter_to_us(cycle_counter_read() - begin,
+                                          result->cpu_hz);
+    result->iterations = dhry_run_count - count;
+}
+
+/*******************************************************************************
+* Function Name: freq_sweep_run
+********************************************************************************
+* Summary:
+* Applies the FREQ_SWEEP_BASE_SPEC_ID profile, then for each system power mode
+* runs one window at each DPLL-LP frequency that the mode allows (see
+* point_allowed()). Frequencies above the limit of a mode are skipped. The
+* points are stored in freq_sweep_results in the order they ran. The base
+* profile stays applied.
+*
+* Parameters:
+*  modes: System power modes, in order
+*  mode_count: Number of modes
+*  freqs: DPLL-LP frequencies; 0 runs the clocks from the IHO
+*  freq_count: Number of frequencies
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void freq_sweep_run(const power_system_mode_t *modes, uint32_t mode_count,
+                    const uint32_t *freqs, uint32_t freq_count)
+{
+    const workload_t *work = workload_find(FREQ_SWEEP_WORKLOAD);
+    const power_profile_t *base = power_profile_find(FREQ_SWEEP_BASE_SPEC_ID);
+    const power_profile_t *reference;
+    power_profile_t *point;
+    uint32_t points_run = 0U;
+    uint32_t mode;
+    uint32_t freq;
+
+    if ((NULL == work) || (NULL == base))
+    {
+        handle_app_error();
+    }
+
+    (void)memset(freq_sweep_results, 0, sizeof(freq_sweep_results));
+
+    power_mode_apply(base);
+    if (NULL != work->init)
+    {
+        work->init();
+    }
+
+    for (mode = 0U; mode < mode_count; mode++)
+    {
+        reference = mode_reference(modes[mode]);
+        if (NULL == reference)
+        {
+            handle_app_error();
+        }
+
+        for (freq = 0U; freq < freq_count; freq++)
+        {
+            if (!point_allowed(reference, freqs[freq]))
+            {
+                continue;
+            }
+            if (points_run >= FREQ_SWEEP_MAX_POINTS)
+            {
+                handle_app_error();
+            }
+
+            point = &points[points_run % 2U];
+            *point = *base;
+            point->name = "sweep";
+            point->marker_code = MARKER_CODE_SWEEP;
+            point->system_mode = reference->system_mode;
+            point->dpll_freq_hz = freqs[freq];
+            point->hf0_divider = reference->hf0_divider;
+            point->hf1_divider = reference->hf1_divider;
+
+            run_point(work, point, &freq_sweep_results[points_run]);
+            points_run++;
+        }
+    }
+
+    if (NULL != work->teardown)
+    {
+        work->teardown();
+    }
+
+    /* Back to the clocks of the base profile */
+    power_mode_scale(base);
+}
+
+#endif /* FREQ_SWEEP_DWELL_MS */
+
+/* [] END OF FILE */
@@ -0,0 +1,78 @@
+/*******************************************************************************
+* File Name        : freq_sweep.h
+*
+* Description      : This file provides the DPLL-LP frequency sweep. It runs
+*                    the Dhrystone workload at each frequency of a list in
+*                    each system power mode that allows it, for a
+*                    performance-versus-current curve.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef FREQ_SWEEP_H
+#define FREQ_SWEEP_H
+
+#include <stdint.h>
+#include "power_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest number of points of a sweep */
+#define FREQ_SWEEP_MAX_POINTS       (32U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    power_system_mode_t system_mode;
+    uint32_t dpll_freq_hz;          /* 0: DPLL-LP off, IHO               */
+    uint32_t cpu_hz;                /* CLK_HF0 of the point              */
+    uint32_t iterations;            /* Workload iterations in the window */
+    uint32_t time_us;               /* Length of the window              */
+} freq_sweep_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Points in the order they ran; unused entries have no time */
+extern freq_sweep_result_t freq_sweep_results[FREQ_SWEEP_MAX_POINTS];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void freq_sweep_run(const power_system_mode_t *modes, uint32_t mode_count,
+                    const uint32_t *freqs, uint32_t freq_count);
+
+#endif /* FREQ_SWEEP_H */
+
+/* [] END OF FILE */
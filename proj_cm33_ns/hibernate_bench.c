@@ -0,0 +1,256 @@
+/*******************************************************************************
+* File Name        : hibernate_bench.c
+*
+* Description      : This file implements the Hibernate cycle benchmark. The
+*                    CM33 arms the WDT to wake the system from Hibernate and,
+*                    after each wakeup, adds the latency of the wakeup to the
+*                    secure and non-secure main() to the statistics in the
+*                    backup registers. It is empty unless
+*                    HIBERNATE_BENCH_CYCLES is defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "lp_timer.h"
+#include "hibernate_bench.h"
+
+#if defined(HIBERNATE_BENCH_CYCLES)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TICKS_TO_US(ticks)          ((uint32_t)(((uint64_t)(ticks) * \
+                                        1000000U) / LP_TIMER_CLK_LF_HZ))
+#define SLEEP_TICKS                 ((HIBERNATE_BENCH_SLEEP_MS * \
+                                      LP_TIMER_CLK_LF_HZ) / 1000U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+hibernate_bench_result_t hibernate_bench_results =
+{
+    0U,
+    {
+        { "boot",   0U, 0U, 0U },
+        { "secure", 0U, 0U, 0U },
+        { "wake",   0U, 0U, 0U }
+    },
+    { 0U }
+};
+
+/*******************************************************************************
+* Function Name: add_sample
+********************************************************************************
+* Summary:
+* Adds the latency of one wakeup to the sum, minimum and maximum of an
+* interval in the backup registers.
+*
+*******************************************************************************/
+static void add_sample(volatile uint32_t *breg, hibernate_interval_t interval,
+                       uint32_t ticks)
+{
+    uint32_t word = HIBERNATE_BENCH_WORD_STATS + (2U * (uint32_t)interval);
+    uint32_t min = breg[word + 1U] & HIBERNATE_BENCH_TICK_MASK;
+    uint32_t max = breg[word + 1U] >> 16;
+
+    min = (ticks < min) ? ticks : min;
+    max = (ticks > max) ? ticks : max;
+    breg[word] += ticks;
+    breg[word + 1U] = (max << 16) | min;
+}
+
+/*******************************************************************************
+* Function Name: add_wakeup
+********************************************************************************
+* Summary:
+* Adds the wakeup that just happened to the statistics, if the previous boot
+* armed it and the secure main() marked it.
+*
+*******************************************************************************/
+static void add_wakeup(volatile uint32_t *breg, uint32_t now)
+{
+    uint32_t wake = breg[HIBERNATE_BENCH_WORD_WAKE];
+    uint32_t secure = breg[HIBERNATE_BENCH_WORD_SECURE];
+    uint32_t wake_ticks;
+    uint32_t bucket;
+    uint32_t word;
+
+    if ((0U == (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HIB_WAKEUP)) ||
+        (0U == (wake & HIBERNATE_BENCH_MARK)) ||
+        (0U == (secure & HIBERNATE_BENCH_MARK)))
+    {
+        return;
+    }
+
+    wake &= HIBERNATE_BENCH_TICK_MASK;
+    secure &= HIBERNATE_BENCH_TICK_MASK;
+    wake_ticks = (now - wake) & HIBERNATE_BENCH_TICK_MASK;
+    add_sample(breg, HIBERNATE_INTERVAL_BOOT,
+               (secure - wake) & HIBERNATE_BENCH_TICK_MASK);
+    add_sample(breg, HIBERNATE_INTERVAL_SECURE,
+               (now - secure) & HIBERNATE_BENCH_TICK_MASK);
+    add_sample(breg, HIBERNATE_INTERVAL_WAKE, wake_ticks);
+
+    bucket = TICKS_TO_US(wake_ticks) / HIBERNATE_BENCH_BUCKET_US;
+    if (bucket >= HIBERNATE_BENCH_BUCKETS)
+    {
+        bucket = HIBERNATE_BENCH_BUCKETS - 1U;
+    }
+    word = HIBERNATE_BENCH_WORD_HIST + (bucket / 2U);
+    breg[word] += 1UL << (16U * (bucket % 2U));
+
+    breg[HIBERNATE_BENCH_WORD_HEADER]++;
+}
+
+/*******************************************************************************
+* Function Name: hibernate_bench_wake
+********************************************************************************
+* Summary:
+* Called first in the non-secure main(). After a Hibernate wakeup it adds the
+* latencies of the wakeup to the statistics in the backup registers, which it
+* clears when they hold none, as after a power-on reset. It then stops the
+* WDT and copies the statistics to hibernate_bench_results.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void hibernate_bench_wake(void)
+{
+    volatile uint32_t *breg = HIBERNATE_BENCH_BREG;
+    uint32_t now = Cy_WDT_GetCount() & HIBERNATE_BENCH_TICK_MASK;
+    uint32_t cycles;
+    uint32_t index;
+    uint32_t word;
+
+    if ((breg[HIBERNATE_BENCH_WORD_HEADER] >> 16) == HIBERNATE_BENCH_MAGIC)
+    {
+        add_wakeup(breg, now);
+    }
+    else
+    {
+        for (index = 0U; index < HIBERNATE_BENCH_WORDS; index++)
+        {
+            breg[index] = 0U;
+        }
+        for (index = 0U; index < (uint32_t)HIBERNATE_INTERVAL_COUNT; index++)
+        {
+            breg[HIBERNATE_BENCH_WORD_STATS + (2U * index) + 1U] =
+                HIBERNATE_BENCH_TICK_MASK;
+        }
+        breg[HIBERNATE_BENCH_WORD_HEADER] =
+            (uint32_t)HIBERNATE_BENCH_MAGIC << 16;
+    }
+    breg[HIBERNATE_BENCH_WORD_WAKE] = 0U;
+    breg[HIBERNATE_BENCH_WORD_SECURE] = 0U;
+    Cy_SysLib_ClearResetReason();
+
+    /* The WDT resets the device unless it is stopped or serviced */
+    Cy_WDT_Unlock();
+    Cy_WDT_Disable();
+    Cy_WDT_Lock();
+
+    cycles = breg[HIBERNATE_BENCH_WORD_HEADER] & HIBERNATE_BENCH_TICK_MASK;
+    hibernate_bench_results.cycles = cycles;
+    for (index = 0U; (0U != cycles) &&
+         (index < (uint32_t)HIBERNATE_INTERVAL_COUNT); index++)
+    {
+        hibernate_interval_result_t *result =
+            &hibernate_bench_results.intervals[index];
+
+        word = HIBERNATE_BENCH_WORD_STATS + (2U * index);
+        result->min_us = TICKS_TO_US(breg[word + 1U] &
+                                     HIBERNATE_BENCH_TICK_MASK);
+        result->max_us = TICKS_TO_US(breg[word + 1U] >> 16);
+        result->mean_us = TICKS_TO_US(breg[word]) / cycles;
+    }
+    for (index = 0U; index < HIBERNATE_BENCH_BUCKETS; index++)
+    {
+        word = HIBERNATE_BENCH_WORD_HIST + (index / 2U);
+        hibernate_bench_results.histogram[index] =
+            (breg[word] >> (16U * (index % 2U))) & HIBERNATE_BENCH_TICK_MASK;
+    }
+}
+
+/*******************************************************************************
+* Function Name: hibernate_bench_arm
+********************************************************************************
+* Summary:
+* Arms the WDT to wake the system from Hibernate HIBERNATE_BENCH_SLEEP_MS
+* from now and records the wakeup tick, unless the benchmark has done its cycles.
+* Call it just before the system enters Hibernate.
+*
+* Parameters:
+*  cycles: Hibernate cycles to measure
+*
+* Return:
+*  bool: false when the cycles are done and the system should stay awake
+*
+*******************************************************************************/
+bool hibernate_bench_arm(uint32_t cycles)
+{
+    volatile uint32_t *breg = HIBERNATE_BENCH_BREG;
+    uint32_t now;
+    uint32_t wake;
+
+    if (hibernate_bench_results.cycles >= cycles)
+    {
+        return false;
+    }
+
+    Cy_SysPm_SetHibernateWakeupSource(CY_SYSPM_HIBERNATE_WDT);
+
+    Cy_WDT_Unlock();
+    Cy_WDT_ClearInterrupt();
+    Cy_WDT_UnmaskInterrupt();
+    now = Cy_WDT_GetCount() & HIBERNATE_BENCH_TICK_MASK;
+    wake = (now + SLEEP_TICKS) & HIBERNATE_BENCH_TICK_MASK;
+    Cy_WDT_SetMatch(wake);
+    Cy_WDT_Enable();
+    Cy_WDT_Lock();
+
+    breg[HIBERNATE_BENCH_WORD_SECURE] = 0U;
+    breg[HIBERNATE_BENCH_WORD_WAKE] = HIBERNATE_BENCH_MARK | wake;
+
+    return true;
+}
+
+#endif /* HIBERNATE_BENCH_CYCLES */
+
+/* [] END OF FILE */
@@ -41,142 +41,78 @@
 *******************************************************************************/
 #include "cybsp.h"
 #include "specs.h"
-#include "dhry.h"
-#include "cy_syspm_ppu.h"
+#include "workload.h"
+#include "duty_cycle.h"
+#include "dvfs.h"
+#include "marker.h"
+#include "power_mode.h"
+#include "transition_bench.h"
+#include "ring_bench.h"
+#include "race_pace.h"
+#include "freq_sweep.h"
+#include "cycle_counter.h"
+#include "event_trace.h"
+#include "hibernate_bench.h"
+#include "sram_retention.h"
 #include "cy_device.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-/* The timeout value in microsecond used to wait for core to be booted */
-#define CM55_BOOT_WAIT_TIME_USEC      (10U)
-#define DPLL_LP_FREQ_HP_MODE          (200000000U)
-#define WAIT_FOR_CM55_EXE             (300U)
 #define DELAY_FOR_HIBERNATE           (100U)
 
-/* App boot address for CM55 project */
-#define CM55_APP_BOOT_ADDR                (CYMEM_CM33_0_m55_nvm_C_START + \
-                                           CYBSP_MCUBOOT_HEADER_SIZE)
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void hibernate_run(void);
 
-#if !defined(SYSTEM_HP) && !defined(SYSTEM_ULP) && (SPEC_ID != SIDDSA) \
-     && (SPEC_ID != SIDHIBA)  && (SPEC_ID != SIDDSO)
 /*******************************************************************************
-* Function Name: dpll_lp_set_freq
-********************************************************************************
-* Summary:
-* Configures the DPLL-LP (Low Power DPLL) frequency.
-*
-* Parameters:
-* uint32_t frequency
-*
-* Return:
-* void
-*
+* Global Variables
 *******************************************************************************/
-static void dpll_lp_set_freq(uint32_t freq)
+/* Workloads that only the CM33 can run */
+static const workload_t hibernate_workload =
 {
-    /* Define a PLL configuration structure */
-    cy_stc_pll_config_t dpll_lp;
-
-    /* Set the input frequency of the PLL */
-    dpll_lp.inputFreq = DPLL_INTPUT_FREQ_HZ;
-
-    /* Set the output mode of the PLL to auto */
-    dpll_lp.outputMode = CY_SYSCLK_FLLPLL_OUTPUT_AUTO;
-
-    /* Set the desired output frequency of the PLL */
-    dpll_lp.outputFreq = freq;
+    "hibernate", NULL, hibernate_run, NULL
+};
 
-    /* Disable the DPLL_HP_0 PLL path */
-    Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
+#if defined(POWER_SEQUENCE)
+/* SPEC IDs stepped through after boot, see specs.h */
+static const uint32_t power_sequence[] = { POWER_SEQUENCE };
+#endif
 
-    /* Configure the PLL with the specified settings */
-    if (CY_SYSCLK_SUCCESS !=
-            Cy_SysClk_PllConfigure(SRSS_DPLL_LP_0_PATH_NUM, 
-            &dpll_lp))
-    {
-        /* Assert if PLL configuration fails */
-       handle_app_error();
-    }
+#if defined(RACE_PACE_STEPS)
+/* Profiles compared on the same work, see specs.h */
+static const uint32_t race_pace_spec_ids[] = { RACE_PACE_SPEC_IDS };
+#endif
 
-    /* Enable the DPLL_HP_0 PLL path with a timeout */
-    if (CY_SYSCLK_SUCCESS !=
-            Cy_SysClk_PllEnable(SRSS_DPLL_LP_0_PATH_NUM, 
-            DPLL_ENABLE_TIMEOUT_MS))
-    {
-        /* Assert if PLL enable fails */
-        handle_app_error();
-    }
-}
+#if defined(FREQ_SWEEP_DWELL_MS)
+/* System power modes and DPLL-LP frequencies of the sweep, see specs.h */
+static const power_system_mode_t freq_sweep_modes[] = { FREQ_SWEEP_MODES };
+static const uint32_t freq_sweep_freqs[] = { FREQ_SWEEP_FREQS };
 #endif
 
 /*******************************************************************************
-* Function Name: configure_system_power_mode
+* Function Name: hibernate_run
 ********************************************************************************
 * Summary:
-* Configures the system power mode to LP or ULP mode. The default configuration 
-* is set to HP mode via the device configurator tool. 
+* Puts the system in Hibernate after a short delay. The newest records of the
+* event trace are kept in the backup registers. With HIBERNATE_BENCH_CYCLES
+* the WDT wakes the system until the cycles are done; the system then stays in
+* Deep Sleep.
+*
 *******************************************************************************/
-static void configure_system_power_mode(void)
-{ 
-
-#if defined(SYSTEM_LP)
-    cy_en_syspm_status_t status;
-    
-    /* Set the DPLL-HP frequency to the low power frequency */
-    dpll_lp_set_freq(DPLL_FREQ_LP_HZ);
-
-#if defined(SET_HF_DIV_ONE)  
-     /* Set HF0 and HF1 Clock divider to 1 */
-    Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_NO_DIVIDE);
-    Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF1, CY_SYSCLK_CLKHF_NO_DIVIDE);
-#endif
-
-    /*  Enter Low Power (LP) mode. */
-    status = Cy_SysPm_SystemEnterLp();
-    if (CY_SYSPM_SUCCESS != status)
-    {
-         handle_app_error();
-    }
-    
-    /* Check if the system successfully entered LP mode. */
-    if (Cy_SysPm_ReadStatus() & CY_SYSPM_STATUS_SYSTEM_LP)
-    {
-        /* Set the RRAM to LP voltage mode for lower power consumption. */ 
-        Cy_RRAM_SetVoltageMode(RRAMC0, CY_RRAM_VMODE_LP);
-    }
-    
-#elif defined(SYSTEM_ULP)
-    cy_en_syspm_status_t status;
-    
-    /* Disable the high-performance DPLL and Directly clock from IHO (50 MHz)*/
-    Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
-
-    /* Enter Ultra-Low Power (ULP) mode. */
-    status = Cy_SysPm_SystemEnterUlp();
-    if (CY_SYSPM_SUCCESS != status)
-    {
-         handle_app_error();
-    }
-    
-    /* Check if the system successfully entered ULP mode. */
-    if (Cy_SysPm_ReadStatus() & CY_SYSPM_STATUS_SYSTEM_ULP)
+static void hibernate_run(void)
+{
+    Cy_SysLib_Delay(DELAY_FOR_HIBERNATE);
+#if defined(HIBERNATE_BENCH_CYCLES)
+    if (!hibernate_bench_arm(HIBERNATE_BENCH_CYCLES))
     {
-        /* Set the RRAM to ULP voltage mode for lower power consumption. */
-        Cy_RRAM_SetVoltageMode(RRAMC0, CY_RRAM_VMODE_ULP);
-
-        /* Set the high-frequency clock (CLKHF) to no divide */
-        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_NO_DIVIDE);
+        (void)Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        return;
     }
-
-#if defined(SYSTEM_HP1)
-    /* Set DPLL LP Frequency to 200 MHz*/
-     dpll_lp_set_freq(DPLL_LP_FREQ_HP_MODE);
- 
-    /* Set HF0 Clock divider to 1 */
-     Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_NO_DIVIDE);
-#endif
 #endif
+    event_trace_hibernate();
+    Cy_SysPm_SystemEnterHibernate();
 }
 
 /*******************************************************************************
@@ -185,9 +121,10 @@ static void configure_system_power_mode(void)
 * Summary:
 * This is the main function of the CM33 non-secure application.  
 * It initializes the device and board peripherals. SMIF and SOCMEM are disabled. 
-* The sytem power mode is configured as mentioned in the specs.h header file. 
-* The CM55 core is enabled and then the programs enters an infinite while and 
-* the selected options, as configured in the specs.h header file, are executed.
+* The power profile of the SPEC_ID configured in the specs.h header file, or
+* each profile of POWER_SEQUENCE in turn, is applied. This sets the system
+* power mode, starts the CM55 core and selects the workloads. The programs then
+* enters an infinite while and runs the selected workload.
 *
 * Parameters:
 * None
@@ -200,6 +137,11 @@ int main(void)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
 
+#if defined(HIBERNATE_BENCH_CYCLES)
+    /* Wakeup latency first, before the boot adds to it, see specs.h */
+    hibernate_bench_wake();
+#endif
+
     /* Initialize the device and board peripherals */ 
     result = cybsp_init();
 
@@ -211,53 +153,80 @@ int main(void)
 
    /* Enable global interrupts */
     __enable_irq();
+
+    /* Free-running cycle counter of the CPU, see cycle_counter.h */
+    cycle_counter_init();
+
+    /* Event trace of the CM33, before the CM55 starts, see specs.h */
+    event_trace_init();
     
+#if !defined(KEEP_SOCMEM)
     /* Disable SoCMEM */
     Cy_SysEnableSOCMEM(false);
+#endif
+
+#if defined(SRAM_MAP_POWER_DOWN)
+    /* Power down the SRAM that no image uses, see specs.h */
+    if (!sram_retention_apply(NULL))
+    {
+        handle_app_error();
+    }
+#endif
+
+    workload_register(&hibernate_workload);
+    workload_register(&duty_cycle_workload);
+    workload_register(&dvfs_workload);
+
+    /* Marker pins of both CPUs, configured before the CM55 starts */
+    marker_init();
+
+    /* A Deep Sleep-OFF wakeup of the duty cycle is a warm boot: run its next
+     * burst in the clocks of the profile without applying it again */
+    if (duty_cycle_resume())
+    {
+        power_mode_scale(power_profile_find(SPEC_ID));
+        for (;;)
+        {
+            workload_step();
+        }
+    }
 
-#if defined(DEEPSLEEP_OFF)
-    /* Use low-power settings for Bandgap reference circuit */
-    SRSS_PWR_CTL2 |= SRSS_PWR_CTL2_BGREF_LPMODE_Msk;
+#if defined(TRANSITION_BENCH_RUNS)
+    /* Time the power transitions from the boot state, see specs.h */
+    transition_bench_run(TRANSITION_BENCH_RUNS);
 #endif
-    
-#if defined(DISABLE_PD1)
-     /* Set deepsleep mode to deepsleep off */
-     Cy_SysPm_SetDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP_OFF);
-#endif   
 
-    /* CM55_APP_BOOT_ADDR must be updated if CM55 memory layout is changed.*/
-    Cy_SysEnableCM55 (MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
-    
-    /* Wait for CM55 execution */
-    Cy_SysLib_Delay(WAIT_FOR_CM55_EXE);
-    
-    /* Configure the system power mode */
-    configure_system_power_mode();
+#if defined(RING_BENCH_MESSAGES)
+    /* Measure the inter-CPU rings in HP, LP and ULP, see specs.h */
+    ring_bench_run(RING_BENCH_MESSAGES);
+#endif
+
+#if defined(RACE_PACE_STEPS)
+    /* Same work under each profile and deadline, see specs.h */
+    race_pace_run(race_pace_spec_ids,
+        sizeof(race_pace_spec_ids) / sizeof(race_pace_spec_ids[0]));
+#endif
+
+#if defined(FREQ_SWEEP_DWELL_MS)
+    /* Same work at each clock frequency of each mode, see specs.h */
+    freq_sweep_run(freq_sweep_modes,
+        sizeof(freq_sweep_modes) / sizeof(freq_sweep_modes[0]),
+        freq_sweep_freqs,
+        sizeof(freq_sweep_freqs) / sizeof(freq_sweep_freqs[0]));
+#endif
 
-#if defined(DISABLE_PD1) 
-     /* Disable HF1 and HF2 clocks */  
-     Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF1);
-     Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF2);
+#if defined(POWER_SEQUENCE)
+    /* Step through the profiles of the sequence, then stay in the last one */
+    power_sequence_run(power_sequence,
+        sizeof(power_sequence) / sizeof(power_sequence[0]), POWER_DWELL_MS);
+#else
+    /* Apply the power profile of SPEC_ID and start the CM55 */
+    power_mode_apply(power_profile_find(SPEC_ID));
 #endif
 
     for (;;)
     {
-        #if defined(CM33_SLEEP) 
-        Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
-        
-        #elif defined(CM33_DEEP_SLEEP)
-        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
-        
-        #elif defined(CM33_HIBERNATE) 
-        Cy_SysLib_Delay(DELAY_FOR_HIBERNATE);
-        Cy_SysPm_SystemEnterHibernate();
-        
-        #elif defined(CM33_WHILE_LOOP)
-        while(true);
-        
-        #elif defined(CM33_DHRYSTONE)
-        dhrystone();
-        #endif
+        workload_step();
     }
 }
 
@@ -0,0 +1,710 @@
+/*******************************************************************************
+* File Name        : power_mode.c
+*
+* Description      : This file moves the system between power profiles at run
+*                    time: system power mode, DPLL-LP and CLK_HF dividers,
+*                    PD1 and the CM55, and the workloads of both CPUs. The
+*                    CM55 is restarted for every profile and applies its part
+*                    of the profile when it boots.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "lp_timer.h"
+#include "workload.h"
+#include "marker.h"
+#include "dpll_lp_table.h"
+#include "gating.h"
+#include "pd_manager.h"
+#include "event_trace.h"
+#include "power_mode.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Longest wait for the CM55 to apply its part of a profile; the fixed boot
+ * wait that the handshake replaces */
+#define CM55_READY_TIMEOUT_US         (300000U)
+
+/* Clock path that the device configurator runs from the IHO */
+#define IHO_CLK_PATH                  (CY_SYSCLK_CLKHF_IN_CLKPATH0)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Clock and power state left by the device configurator at boot */
+static const power_profile_t boot_state =
+{
+    .spec_id = 0U,
+    .name = "boot",
+    .system_mode = POWER_SYSTEM_HP,
+    .dpll_freq_hz = POWER_DPLL_FREQ_HP_HZ,
+    .hf0_divider = CY_SYSCLK_CLKHF_DIVIDE_BY_2,
+    .hf1_divider = CY_SYSCLK_CLKHF_NO_DIVIDE,
+    .disable_pd1 = false,
+    .disable_cm55 = false,
+    .deepsleep_off = false,
+    .cm33_workload = NULL,
+    .cm55_workload = NULL,
+    .gating = &gating_manifest_boot,
+    .sram_retention = NULL,
+    .marker_code = 0U
+};
+
+static const power_profile_t *current_profile = &boot_state;
+
+/* Profile whose system power mode and clocks are set; differs from
+ * current_profile after power_mode_scale() */
+static const power_profile_t *current_clocks = &boot_state;
+
+static bool cm55_started = false;
+
+/* DPLL-LP frequency change in progress, and the CLK_HF sources to restore */
+static bool dpll_lp_switching = false;
+static cy_en_clkhf_in_sources_t hf0_source;
+static cy_en_clkhf_in_sources_t hf1_source;
+
+/*******************************************************************************
+* Function Name: dpll_lp_find_setting
+********************************************************************************
+* Summary:
+* Returns the precomputed DPLL-LP setting of a frequency, or NULL if the
+* frequency is not in the table.
+*
+*******************************************************************************/
+static const dpll_lp_setting_t *dpll_lp_find_setting(uint32_t freq)
+{
+    uint32_t index;
+
+    for (index = 0U; index < dpll_lp_table_count; index++)
+    {
+        if (dpll_lp_table[index].freq_hz == freq)
+        {
+            return &dpll_lp_table[index];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: dpll_lp_configure
+********************************************************************************
+* Summary:
+* Writes a precomputed setting to the DPLL-LP registers. The loop gains and
+* other lock settings are those that the device configurator set at boot;
+* they are read once and kept for every later setting.
+*
+*******************************************************************************/
+static cy_en_sysclk_status_t dpll_lp_configure(const dpll_lp_setting_t *setting)
+{
+    static cy_stc_dpll_lp_config_t dpll_lp_regs;
+    static bool dpll_lp_regs_read = false;
+    cy_stc_pll_manual_config_t manual = { .lpPllCfg = &dpll_lp_regs };
+
+    if (!dpll_lp_regs_read)
+    {
+        if (CY_SYSCLK_SUCCESS !=
+                Cy_SysClk_PllGetConfiguration(SRSS_DPLL_LP_0_PATH_NUM,
+                &manual))
+        {
+            handle_app_error();
+        }
+        dpll_lp_regs_read = true;
+    }
+
+    dpll_lp_regs.feedbackDiv = setting->feedback_div;
+    dpll_lp_regs.referenceDiv = setting->reference_div;
+    dpll_lp_regs.outputDiv = setting->output_div;
+    dpll_lp_regs.fracDiv = setting->frac_div;
+    dpll_lp_regs.fracEn = (0U != setting->frac_div);
+    dpll_lp_regs.fracDitherEn = false;
+    dpll_lp_regs.outputMode = CY_SYSCLK_FLLPLL_OUTPUT_AUTO;
+
+    return Cy_SysClk_PllManualConfigure(SRSS_DPLL_LP_0_PATH_NUM, &manual);
+}
+
+/*******************************************************************************
+* Function Name: dpll_lp_start
+********************************************************************************
+* Summary:
+* Disables the DPLL-LP, configures it for a frequency and enables it again,
+* waiting at most timeout_us for the lock. Frequencies of the precomputed
+* table (proj_cm33_ns/dpll_lp_table.c) only write the PLL registers; any
+* other frequency lets the PDL compute the dividers.
+*
+*******************************************************************************/
+static cy_en_sysclk_status_t dpll_lp_start(uint32_t freq, uint32_t timeout_us)
+{
+    const dpll_lp_setting_t *setting = dpll_lp_find_setting(freq);
+    cy_en_sysclk_status_t status;
+
+    /* Define a PLL configuration structure */
+    cy_stc_pll_config_t dpll_lp;
+
+    /* Disable the DPLL_HP_0 PLL path */
+    Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
+
+    if (NULL != setting)
+    {
+        status = dpll_lp_configure(setting);
+    }
+    else
+    {
+        /* Set the input frequency of the PLL */
+        dpll_lp.inputFreq = DPLL_INTPUT_FREQ_HZ;
+
+        /* Set the output mode of the PLL to auto */
+        dpll_lp.outputMode = CY_SYSCLK_FLLPLL_OUTPUT_AUTO;
+
+        /* Set the desired output frequency of the PLL */
+        dpll_lp.outputFreq = freq;
+
+        /* Configure the PLL with the specified settings */
+        status = Cy_SysClk_PllConfigure(SRSS_DPLL_LP_0_PATH_NUM, &dpll_lp);
+    }
+
+    if (CY_SYSCLK_SUCCESS != status)
+    {
+        /* Assert if PLL configuration fails */
+       handle_app_error();
+    }
+
+    /* Enable the DPLL_HP_0 PLL path with a timeout */
+    return Cy_SysClk_PllEnable(SRSS_DPLL_LP_0_PATH_NUM, timeout_us);
+}
+
+/*******************************************************************************
+* Function Name: dpll_lp_set_freq
+********************************************************************************
+* Summary:
+* Configures the DPLL-LP (Low Power DPLL) frequency and waits for the lock.
+* The clocks of the DPLL-LP path run from its IHO reference until then.
+*
+* Parameters:
+* uint32_t frequency
+*
+* Return:
+* void
+*
+*******************************************************************************/
+void dpll_lp_set_freq(uint32_t freq)
+{
+    if (CY_SYSCLK_SUCCESS != dpll_lp_start(freq, DPLL_ENABLE_TIMEOUT_MS))
+    {
+        /* Assert if PLL enable fails */
+        handle_app_error();
+    }
+}
+
+/*******************************************************************************
+* Function Name: dpll_lp_switch_begin
+********************************************************************************
+* Summary:
+* Starts a DPLL-LP frequency change without waiting for the lock. CLK_HF0
+* (CM33) and CLK_HF1 (CM55) are moved to the IHO path first, so both CPUs
+* keep running, at the IHO frequency over their dividers, while the DPLL-LP
+* relocks. dpll_lp_switch_poll() or dpll_lp_switch_wait() moves them back
+* once it has locked. A switch still in progress is completed first.
+*
+* Parameters:
+*  freq: DPLL-LP frequency
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void dpll_lp_switch_begin(uint32_t freq)
+{
+    cy_en_sysclk_status_t status;
+
+    dpll_lp_switch_wait();
+
+    hf0_source = Cy_SysClk_ClkHfGetSource(CY_CFG_SYSCLK_CLKHF0);
+    hf1_source = Cy_SysClk_ClkHfGetSource(CY_CFG_SYSCLK_CLKHF1);
+    (void)Cy_SysClk_ClkHfSetSource(CY_CFG_SYSCLK_CLKHF0, IHO_CLK_PATH);
+    (void)Cy_SysClk_ClkHfSetSource(CY_CFG_SYSCLK_CLKHF1, IHO_CLK_PATH);
+
+    /* A zero timeout enables the DPLL-LP without waiting for the lock */
+    status = dpll_lp_start(freq, 0U);
+    if ((CY_SYSCLK_SUCCESS != status) && (CY_SYSCLK_TIMEOUT != status))
+    {
+        handle_app_error();
+    }
+
+    dpll_lp_switching = true;
+}
+
+/*******************************************************************************
+* Function Name: dpll_lp_switch_poll
+********************************************************************************
+* Summary:
+* Completes a DPLL-LP frequency change once the DPLL-LP has locked: CLK_HF1
+* and CLK_HF0 go back to their sources. Call it between pieces of work while
+* the relock runs.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if no switch is in progress
+*
+*******************************************************************************/
+bool dpll_lp_switch_poll(void)
+{
+    if (dpll_lp_switching && Cy_SysClk_PllLocked(SRSS_DPLL_LP_0_PATH_NUM))
+    {
+        (void)Cy_SysClk_ClkHfSetSource(CY_CFG_SYSCLK_CLKHF1, hf1_source);
+        (void)Cy_SysClk_ClkHfSetSource(CY_CFG_SYSCLK_CLKHF0, hf0_source);
+        dpll_lp_switching = false;
+    }
+
+    return !dpll_lp_switching;
+}
+
+/*******************************************************************************
+* Function Name: dpll_lp_switch_wait
+********************************************************************************
+* Summary:
+* Waits until a DPLL-LP frequency change has completed. A DPLL-LP that does
+* not lock within the timeout of dpll_lp_set_freq() is an error.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void dpll_lp_switch_wait(void)
+{
+    uint32_t waited_us = 0U;
+
+    while (!dpll_lp_switch_poll())
+    {
+        /* DPLL_ENABLE_TIMEOUT_MS is the microsecond timeout of
+         * Cy_SysClk_PllEnable() */
+        if (waited_us >= DPLL_ENABLE_TIMEOUT_MS)
+        {
+            handle_app_error();
+        }
+        Cy_SysLib_DelayUs(1U);
+        waited_us++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: set_dividers
+********************************************************************************
+* Summary:
+* Sets the dividers of CLK_HF0 (CM33) and CLK_HF1 (CM55) of a profile that
+* divide more (raise is true) or less (raise is false) than the current ones.
+*
+* Parameters:
+*  profile: profile with the new dividers
+*  raise: true to apply only the larger dividers, false for the smaller ones
+*
+*******************************************************************************/
+static void set_dividers(const power_profile_t *profile, bool raise)
+{
+    if ((profile->hf0_divider > current_clocks->hf0_divider) == raise &&
+        profile->hf0_divider != current_clocks->hf0_divider)
+    {
+        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, profile->hf0_divider);
+    }
+
+    if ((profile->hf1_divider > current_clocks->hf1_divider) == raise &&
+        profile->hf1_divider != current_clocks->hf1_divider)
+    {
+        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF1, profile->hf1_divider);
+    }
+}
+
+/*******************************************************************************
+* Function Name: set_clocks
+********************************************************************************
+* Summary:
+* Sets the DPLL-LP and the dividers of CLK_HF0 (CM33) and CLK_HF1 (CM55) of a
+* profile. A DPLL-LP frequency of 0 turns the DPLL off so that the clock
+* paths run directly from the IHO (50 MHz). With DPLL_SWITCH_ON_IHO, the
+* DPLL-LP relocks while the CPUs run from the IHO; the transition completes
+* the switch at its end. Dividers that grow are set before the DPLL-LP and
+* dividers that shrink after it, so that no clock passes through a frequency
+* above both the old and the new profile.
+*
+*******************************************************************************/
+static void set_clocks(const power_profile_t *profile)
+{
+    set_dividers(profile, true);
+
+    if (profile->dpll_freq_hz != current_clocks->dpll_freq_hz)
+    {
+        if (0U == profile->dpll_freq_hz)
+        {
+            dpll_lp_switch_wait();
+            Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
+        }
+        else
+        {
+#if defined(DPLL_SWITCH_ON_IHO)
+            dpll_lp_switch_begin(profile->dpll_freq_hz);
+#else
+            dpll_lp_set_freq(profile->dpll_freq_hz);
+#endif
+        }
+    }
+
+    set_dividers(profile, false);
+}
+
+/*******************************************************************************
+* Function Name: enter_system_mode
+********************************************************************************
+* Summary:
+* Enters the HP, LP or ULP system power mode and sets the RRAM to the matching
+* voltage mode.
+*
+*******************************************************************************/
+static void enter_system_mode(power_system_mode_t mode)
+{
+    static const uint32_t status_mask[] =
+    {
+        CY_SYSPM_STATUS_SYSTEM_HP,
+        CY_SYSPM_STATUS_SYSTEM_LP,
+        CY_SYSPM_STATUS_SYSTEM_ULP
+    };
+    static const cy_en_rram_vmode_t rram_vmode[] =
+    {
+        CY_RRAM_VMODE_HP,
+        CY_RRAM_VMODE_LP,
+        CY_RRAM_VMODE_ULP
+    };
+    cy_en_syspm_status_t status;
+
+    switch (mode)
+    {
+        case POWER_SYSTEM_LP:
+            status = Cy_SysPm_SystemEnterLp();
+            break;
+
+        case POWER_SYSTEM_ULP:
+            status = Cy_SysPm_SystemEnterUlp();
+            break;
+
+        default:
+            status = Cy_SysPm_SystemEnterHp();
+            break;
+    }
+
+    if (CY_SYSPM_SUCCESS != status)
+    {
+         handle_app_error();
+    }
+
+    /* Check if the system successfully entered the mode */
+    if (Cy_SysPm_ReadStatus() & status_mask[mode])
+    {
+        Cy_RRAM_SetVoltageMode(RRAMC0, rram_vmode[mode]);
+    }
+    EVENT_TRACE(EVENT_TRACE_SYSTEM_MODE, mode);
+}
+
+/*******************************************************************************
+* Function Name: configure_system_power_mode
+********************************************************************************
+* Summary:
+* Moves the system power mode and clocks to those of a profile. Going up in
+* performance, the voltage is raised before the clocks; going down, the clocks
+* are lowered first.
+*
+*******************************************************************************/
+static void configure_system_power_mode(const power_profile_t *profile)
+{
+    if (profile->system_mode < current_clocks->system_mode)
+    {
+        enter_system_mode(profile->system_mode);
+        set_clocks(profile);
+    }
+    else
+    {
+        set_clocks(profile);
+        if (profile->system_mode != current_clocks->system_mode)
+        {
+            enter_system_mode(profile->system_mode);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: wait_for_cm55
+********************************************************************************
+* Summary:
+* Waits until the booted CM55 signals that it has applied the profile. When
+* the profile powers the CM55 off, it also waits for the APPCPU domain to
+* reach OFF, which happens once the CM55 waits for interrupts after the
+* signal. A CM55 that does not answer is given CM55_READY_TIMEOUT_US, as the
+* fixed boot wait did before.
+*
+*******************************************************************************/
+static void wait_for_cm55(const power_profile_t *profile)
+{
+    uint32_t waited_us = 0U;
+
+    if (!power_profile_wait_ready(profile, CM55_READY_TIMEOUT_US))
+    {
+        return;
+    }
+
+    if (profile->disable_pd1 || profile->disable_cm55)
+    {
+        while ((0U != (pd_manager_state() &
+                       PD_MANAGER_DOMAIN(PD_DOMAIN_APPCPU))) &&
+               (waited_us < CM55_READY_TIMEOUT_US))
+        {
+            Cy_SysLib_DelayUs(POWER_PROFILE_READY_POLL_US);
+            waited_us += POWER_PROFILE_READY_POLL_US;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: restart_cm55
+********************************************************************************
+* Summary:
+* Holds the CM55 in reset, powers up the domains that the previous profile
+* turned off, posts the new profile and boots the CM55 again. Returns once
+* the CM55 has applied the profile.
+*
+*******************************************************************************/
+static void restart_cm55(const power_profile_t *profile)
+{
+    if (cm55_started)
+    {
+        Cy_SysDisableCM55(MXCM55);
+    }
+
+    /* Power up the domains that the previous profile turned off */
+    if (!pd_manager_set(PD_MANAGER_ALL, NULL))
+    {
+        handle_app_error();
+    }
+
+    /* PD1 powers up all SOCMEM partitions, see SRAM_MAP_POWER_DOWN */
+    sram_retention_socmem_apply();
+
+    /* The CM55 boots with the PD1 clocks of the boot state */
+    gating_apply(&gating_manifest_boot);
+
+    power_profile_post(profile);
+
+    /* CM55_APP_BOOT_ADDR must be updated if CM55 memory layout is changed.*/
+    EVENT_TRACE(EVENT_TRACE_CM55_START, 0U);
+    Cy_SysEnableCM55 (MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
+    cm55_started = true;
+
+    /* Wait for the CM55 to apply its part of the profile */
+    wait_for_cm55(profile);
+}
+
+/*******************************************************************************
+* Function Name: power_mode_apply
+********************************************************************************
+* Summary:
+* Applies a power profile: Deep Sleep settings, CM55 restart with its part of
+* the profile, system power mode and clocks, clock gating, SRAM retention and
+* the CM33 workload. The gating that results is read back into gating_audit.
+* The transition and the profile that follows are separate marker phases.
+*
+* Parameters:
+*  profile: Profile to apply
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_mode_apply(const power_profile_t *profile)
+{
+    if (NULL == profile)
+    {
+        handle_app_error();
+    }
+
+    marker_phase(MARKER_CODE_TRANSITION);
+    EVENT_TRACE(EVENT_TRACE_TRANSITION_BEGIN, profile->spec_id);
+
+    if (profile->deepsleep_off != current_profile->deepsleep_off)
+    {
+        /* Use low-power settings for Bandgap reference circuit */
+        if (profile->deepsleep_off)
+        {
+            SRSS_PWR_CTL2 |= SRSS_PWR_CTL2_BGREF_LPMODE_Msk;
+        }
+        else
+        {
+            SRSS_PWR_CTL2 &= ~SRSS_PWR_CTL2_BGREF_LPMODE_Msk;
+        }
+    }
+
+    if (power_profile_deep_sleep_mode(profile) !=
+        power_profile_deep_sleep_mode(current_profile))
+    {
+        /* Set deepsleep mode to deepsleep off while PD1 is disabled, unless
+         * the profile retains part of the SRAM */
+        Cy_SysPm_SetDeepSleepMode(power_profile_deep_sleep_mode(profile));
+    }
+
+    /* The CM55 boots with all SRAM powered */
+    if ((NULL != current_profile->sram_retention) &&
+        !sram_retention_apply(NULL))
+    {
+        handle_app_error();
+    }
+
+    restart_cm55(profile);
+
+    /* Configure the system power mode */
+    configure_system_power_mode(profile);
+
+    /* Gate the PD1 clocks of the profile; the CM55 has gated its own */
+    gating_apply(profile->gating);
+
+    dpll_lp_switch_wait();
+
+    /* Power down the SRAM that the profile does not retain */
+    if ((NULL != profile->sram_retention) &&
+        !sram_retention_apply(profile->sram_retention))
+    {
+        handle_app_error();
+    }
+
+    gating_audit_read(profile->gating, &gating_audit);
+#if defined(GATING_AUDIT_CHECK)
+    if ((0U != gating_audit.hf_leaks) || (0U != gating_audit.peri_slave_leaks))
+    {
+        handle_app_error();
+    }
+#endif
+
+    current_profile = profile;
+    current_clocks = profile;
+
+    if (!workload_select(profile->cm33_workload))
+    {
+        handle_app_error();
+    }
+
+    /* The profile window lasts until the next transition */
+    EVENT_TRACE(EVENT_TRACE_TRANSITION_END, profile->spec_id);
+    marker_phase(power_profile_marker_code(profile));
+}
+
+/*******************************************************************************
+* Function Name: power_mode_scale
+********************************************************************************
+* Summary:
+* Moves the system power mode and clocks to those of a profile without
+* restarting the CM55 or changing the workloads, Deep Sleep settings or power
+* domains of the applied profile. Used by the DVFS governor to change the
+* operating point while a workload runs.
+*
+* Parameters:
+*  profile: Profile whose system power mode and clocks are set
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_mode_scale(const power_profile_t *profile)
+{
+    if (NULL == profile)
+    {
+        handle_app_error();
+    }
+
+    marker_phase(MARKER_CODE_TRANSITION);
+    EVENT_TRACE(EVENT_TRACE_TRANSITION_BEGIN, profile->spec_id);
+
+    configure_system_power_mode(profile);
+    dpll_lp_switch_wait();
+    current_clocks = profile;
+
+    EVENT_TRACE(EVENT_TRACE_TRANSITION_END, profile->spec_id);
+    marker_phase(power_profile_marker_code(profile));
+}
+
+/*******************************************************************************
+* Function Name: power_mode_current
+********************************************************************************
+* Summary:
+* Returns the last applied profile.
+*
+*******************************************************************************/
+const power_profile_t *power_mode_current(void)
+{
+    return current_profile;
+}
+
+/*******************************************************************************
+* Function Name: power_sequence_run
+********************************************************************************
+* Summary:
+* Applies each profile of a list in turn and runs its workloads for the dwell
+* time. The last profile stays applied when the function returns. A profile
+* whose CM33 workload does not return (hibernate) ends the sequence.
+*
+* Parameters:
+*  spec_ids: SPEC IDs of the profiles, in order
+*  count: Number of SPEC IDs
+*  dwell_ms: Time spent in each profile
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_sequence_run(const uint32_t *spec_ids, uint32_t count,
+                        uint32_t dwell_ms)
+{
+    uint32_t index;
+
+    for (index = 0U; index < count; index++)
+    {
+        power_mode_apply(power_profile_find(spec_ids[index]));
+        lp_timer_wait_ms(dwell_ms, workload_step);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,72 @@
+/*******************************************************************************
+* File Name        : power_mode.h
+*
+* Description      : This file provides the functions that move the system
+*                    from one power profile to another at run time.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef POWER_MODE_H
+#define POWER_MODE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cybsp.h"
+#include "power_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The timeout value in microsecond used to wait for core to be booted */
+#define CM55_BOOT_WAIT_TIME_USEC      (10U)
+
+/* App boot address for CM55 project */
+#define CM55_APP_BOOT_ADDR            (CYMEM_CM33_0_m55_nvm_C_START + \
+                                       CYBSP_MCUBOOT_HEADER_SIZE)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void dpll_lp_set_freq(uint32_t freq);
+void dpll_lp_switch_begin(uint32_t freq);
+bool dpll_lp_switch_poll(void);
+void dpll_lp_switch_wait(void);
+void power_mode_apply(const power_profile_t *profile);
+void power_mode_scale(const power_profile_t *profile);
+const power_profile_t *power_mode_current(void);
+void power_sequence_run(const uint32_t *spec_ids, uint32_t count,
+                        uint32_t dwell_ms);
+
+#endif /* POWER_MODE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* File Name        : race_pace.c
+*
+* Description      : This file implements the race-to-idle versus
+*                    pace-to-deadline comparison. For each profile the CM33
+*                    runs the same batch of a registered workload once per
+*                    deadline and spends the rest of the deadline in Deep
+*                    Sleep. A fast profile races to idle, a slow one paces
+*                    the work to the deadline. It is empty unless
+*                    RACE_PACE_STEPS is defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "cybsp.h"
+#include "specs.h"
+#include "cycle_counter.h"
+#include "lp_timer.h"
+#include "marker.h"
+#include "workload.h"
+#include "power_mode.h"
+#include "race_pace.h"
+
+#if defined(RACE_PACE_STEPS)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+race_pace_result_t race_pace_results[RACE_PACE_MAX_STRATEGIES];
+
+/*******************************************************************************
+* Function Name: idle_step
+********************************************************************************
+* Summary:
+* Deep Sleep until the next interrupt. The profiles of the comparison keep the
+* CM55 off, so the system enters Deep Sleep.
+*
+*******************************************************************************/
+static void idle_step(void)
+{
+    (void)Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+}
+
+/*******************************************************************************
+* Function Name: run_batch
+********************************************************************************
+* Summary:
+* Runs RACE_PACE_STEPS steps of a workload and returns the time they took.
+*
+*******************************************************************************/
+static uint32_t run_batch(const workload_t *work, uint32_t cpu_hz)
+{
+    uint32_t begin = cycle_counter_read();
+    uint32_t step;
+
+    for (step = 0U; step < RACE_PACE_STEPS; step++)
+    {
+        work->run();
+    }
+
+    return cycle_counter_to_us(cycle_counter_read() - begin, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: race_pace_run
+********************************************************************************
+* Summary:
+* Applies each profile in turn and runs RACE_PACE_ROUNDS batches in it, one
+* per RACE_PACE_DEADLINE_MS. The work of each batch is a marker phase with
+* the SPEC ID as code and the idle time after it a MARKER_CODE_WORK_DONE
+* phase, so the energy of a strategy is the charge of both windows. The
+* work times are stored in race_pace_results. The last profile stays
+* applied.
+*
+* Parameters:
+*  spec_ids: SPEC IDs of the profiles, at most RACE_PACE_MAX_STRATEGIES
+*  count: Number of SPEC IDs
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void race_pace_run(const uint32_t *spec_ids, uint32_t count)
+{
+    const workload_t *work = workload_find(RACE_PACE_WORKLOAD);
+    const power_profile_t *profile;
+    race_pace_result_t *result;
+    uint32_t cpu_hz;
+    uint32_t work_ms;
+    uint32_t index;
+    uint32_t round;
+
+    if ((NULL == work) || (count > RACE_PACE_MAX_STRATEGIES))
+    {
+        handle_app_error();
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        profile = power_profile_find(spec_ids[index]);
+        if (NULL == profile)
+        {
+            handle_app_error();
+        }
+
+        result = &race_pace_results[index];
+        (void)memset(result, 0, sizeof(*result));
+        result->spec_id = profile->spec_id;
+
+        power_mode_apply(profile);
+        cpu_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+
+        if (NULL != work->init)
+        {
+            work->init();
+        }
+
+        for (round = 0U; round < RACE_PACE_ROUNDS; round++)
+        {
+            marker_phase(profile->spec_id);
+            result->work_us = run_batch(work, cpu_hz);
+            marker_phase(MARKER_CODE_WORK_DONE);
+
+            result->rounds++;
+            if (result->work_us > result->max_work_us)
+            {
+                result->max_work_us = result->work_us;
+            }
+
+            work_ms = (result->work_us + 999U) / 1000U;
+            if (work_ms < RACE_PACE_DEADLINE_MS)
+            {
+                lp_timer_wait_ms(RACE_PACE_DEADLINE_MS - work_ms, idle_step);
+            }
+            else
+            {
+                result->missed++;
+            }
+        }
+
+        if (NULL != work->teardown)
+        {
+            work->teardown();
+        }
+    }
+}
+
+#endif /* RACE_PACE_STEPS */
+
+/* [] END OF FILE */
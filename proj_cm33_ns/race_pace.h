@@ -0,0 +1,74 @@
+/*******************************************************************************
+* File Name        : race_pace.h
+*
+* Description      : This file provides the race-to-idle versus
+*                    pace-to-deadline comparison: the same batch of work runs
+*                    under several power profiles within the same deadline.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef RACE_PACE_H
+#define RACE_PACE_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest number of profiles compared */
+#define RACE_PACE_MAX_STRATEGIES    (8U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t spec_id;               /* Profile of the strategy             */
+    uint32_t rounds;                /* Batches run                         */
+    uint32_t work_us;               /* Work time of the last batch         */
+    uint32_t max_work_us;           /* Longest work time                   */
+    uint32_t missed;                /* Batches that overran the deadline   */
+} race_pace_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern race_pace_result_t race_pace_results[RACE_PACE_MAX_STRATEGIES];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void race_pace_run(const uint32_t *spec_ids, uint32_t count);
+
+#endif /* RACE_PACE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* File Name        : ring_bench.c
+*
+* Description      : This file implements the CM33 side of the ring buffer
+*                    benchmark. For each system power mode it streams
+*                    messages to the CM55 to measure the throughput, and
+*                    times round trips through the CM55 echo workload to
+*                    measure the one-way latency. It is empty unless
+*                    RING_BENCH_MESSAGES is defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "cycle_counter.h"
+#include "ring.h"
+#include "ring_bench.h"
+#include "power_mode.h"
+
+#if defined(RING_BENCH_MESSAGES)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Longest wait for an echo before the CM55 is considered stopped */
+#define RING_BENCH_TIMEOUT_NS       (1000000000U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Profiles with both CPUs running, one per system power mode */
+ring_bench_result_t ring_bench_results[RING_BENCH_MODES] =
+{
+    { "hp",  SIDH20A, 0U, { 0U } },
+    { "lp",  SIDL20B, 0U, { 0U } },
+    { "ulp", SIDU20C, 0U, { 0U } }
+};
+
+static uint32_t samples[RING_BENCH_ROUND_TRIPS];
+static uint32_t next_seq;
+
+/*******************************************************************************
+* Function Name: send
+********************************************************************************
+* Summary:
+* Sends a message to the CM55, waiting while the ring is full.
+*
+*******************************************************************************/
+static void send(ring_t *ring, uint32_t type)
+{
+    ring_msg_t msg = { 0U };
+
+    msg.type = type;
+    msg.seq = next_seq++;
+    while (!ring_push(ring, &msg))
+    {
+        __NOP();
+    }
+}
+
+/*******************************************************************************
+* Function Name: wait_echo
+********************************************************************************
+* Summary:
+* Waits for the echo of the last message sent. Any other message, or no echo
+* within RING_BENCH_TIMEOUT_NS, is an application error.
+*
+*******************************************************************************/
+static void wait_echo(ring_t *ring, uint32_t cpu_hz)
+{
+    const uint32_t begin = cycle_counter_read();
+    ring_msg_t msg;
+
+    while (!ring_pop(ring, &msg))
+    {
+        if (cycle_counter_to_ns(cycle_counter_read() - begin, cpu_hz) >
+            RING_BENCH_TIMEOUT_NS)
+        {
+            handle_app_error();
+        }
+        __NOP();
+    }
+
+    if ((RING_BENCH_MSG_ECHO != msg.type) || ((next_seq - 1U) != msg.seq))
+    {
+        handle_app_error();
+    }
+}
+
+/*******************************************************************************
+* Function Name: measure
+********************************************************************************
+* Summary:
+* Measures the rings in the current power mode. The stream ends with an echo
+* message, so its time runs until the CM55 has consumed every message. The
+* one-way latency is half of a round trip, which includes the pop and push
+* of the CM55.
+*
+*******************************************************************************/
+static void measure(ring_bench_result_t *result, uint32_t messages)
+{
+    ring_channel_t *channel = ring_channel();
+    const uint32_t cpu_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+    uint32_t begin;
+    uint32_t ns;
+    uint32_t run;
+
+    begin = cycle_counter_read();
+    for (run = 1U; run < messages; run++)
+    {
+        send(&channel->to_cm55, RING_BENCH_MSG_STREAM);
+    }
+    send(&channel->to_cm55, RING_BENCH_MSG_ECHO);
+    wait_echo(&channel->to_cm33, cpu_hz);
+    ns = cycle_counter_to_ns(cycle_counter_read() - begin, cpu_hz);
+    result->messages_per_s = (0U == ns) ? 0U :
+        (uint32_t)(((uint64_t)messages * 1000000000U) / ns);
+
+    for (run = 0U; run < RING_BENCH_ROUND_TRIPS; run++)
+    {
+        begin = cycle_counter_read();
+        send(&channel->to_cm55, RING_BENCH_MSG_ECHO);
+        wait_echo(&channel->to_cm33, cpu_hz);
+        samples[run] = cycle_counter_to_ns(cycle_counter_read() - begin,
+                                           cpu_hz) / 2U;
+    }
+    bench_stats_compute(samples, RING_BENCH_ROUND_TRIPS, &result->one_way_ns);
+}
+
+/*******************************************************************************
+* Function Name: ring_bench_run
+********************************************************************************
+* Summary:
+* Empties the rings, then applies the HP, LP and ULP profiles in turn and
+* measures the rings in each. The CM55 runs the echo workload in every
+* profile while the benchmark is built in. The ULP profile stays applied.
+*
+* Parameters:
+*  messages: Messages streamed per power mode, at least 1
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void ring_bench_run(uint32_t messages)
+{
+    ring_channel_t *channel = ring_channel();
+    uint32_t mode;
+
+    if (0U == messages)
+    {
+        handle_app_error();
+    }
+
+    ring_init(&channel->to_cm55);
+    ring_init(&channel->to_cm33);
+
+    for (mode = 0U; mode < RING_BENCH_MODES; mode++)
+    {
+        power_mode_apply(power_profile_find(ring_bench_results[mode].spec_id));
+        measure(&ring_bench_results[mode], messages);
+    }
+}
+
+#endif /* RING_BENCH_MESSAGES */
+
+/* [] END OF FILE */
@@ -0,0 +1,368 @@
+/*******************************************************************************
+* File Name        : transition_bench.c
+*
+* Description      : This file implements the benchmark of the power
+*                    transitions. Each transition is repeated and timed with
+*                    the DWT cycle counter while the CM33 runs at a fixed
+*                    clock, and the samples are summarized as min, median,
+*                    99th percentile and max in nanoseconds. It is empty
+*                    unless TRANSITION_BENCH_RUNS is defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "cycle_counter.h"
+#include "lp_timer.h"
+#include "pd_manager.h"
+#include "power_mode.h"
+#include "transition_bench.h"
+
+#if defined(TRANSITION_BENCH_RUNS)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* DPLL-LP frequency locked by the relock benchmark */
+#define TRANSITION_DPLL_FREQ_HZ     (200000000U)
+
+/* CM55 run time between an enable and the next disable */
+#define TRANSITION_CM55_RUN_MS      (1U)
+
+/* Sample buffers in use at once: the four legs of a mode round trip */
+#define TRANSITION_BUFFERS          (4U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+transition_result_t transition_results[TRANSITION_COUNT] =
+{
+    [TRANSITION_DPLL_RELOCK]      = { "dpll relock",       { 0U } },
+    [TRANSITION_DPLL_SWITCH_BEGIN] = { "dpll switch begin", { 0U } },
+    [TRANSITION_DPLL_SWITCH_LOCK] = { "dpll switch lock",  { 0U } },
+    [TRANSITION_SYSTEM_HP_TO_LP]  = { "system hp->lp",     { 0U } },
+    [TRANSITION_RRAM_HP_TO_LP]    = { "rram hp->lp",       { 0U } },
+    [TRANSITION_SYSTEM_LP_TO_HP]  = { "system lp->hp",     { 0U } },
+    [TRANSITION_RRAM_LP_TO_HP]    = { "rram lp->hp",       { 0U } },
+    [TRANSITION_SYSTEM_HP_TO_ULP] = { "system hp->ulp",    { 0U } },
+    [TRANSITION_RRAM_HP_TO_ULP]   = { "rram hp->ulp",      { 0U } },
+    [TRANSITION_SYSTEM_ULP_TO_HP] = { "system ulp->hp",    { 0U } },
+    [TRANSITION_RRAM_ULP_TO_HP]   = { "rram ulp->hp",      { 0U } },
+    [TRANSITION_PD1_DOWN]         = { "pd1 down",          { 0U } },
+    [TRANSITION_PD1_UP]           = { "pd1 up",            { 0U } },
+    [TRANSITION_CM55_ENABLE]      = { "cm55 enable",       { 0U } },
+    [TRANSITION_SLEEP_EXIT]       = { "sleep exit",        { 0U } },
+    [TRANSITION_DEEP_SLEEP_EXIT]  = { "deep sleep exit",   { 0U } }
+};
+
+static uint32_t samples[TRANSITION_BUFFERS][TRANSITION_BENCH_MAX_RUNS];
+static uint32_t cpu_hz;
+
+/*******************************************************************************
+* Function Name: summarize
+********************************************************************************
+* Summary:
+* Converts a sample buffer from cycles to nanoseconds and stores its
+* statistics as the result of a transition.
+*
+*******************************************************************************/
+static void summarize(transition_id_t id, uint32_t *buffer, uint32_t runs,
+                      uint32_t hz)
+{
+    uint32_t run;
+
+    for (run = 0U; run < runs; run++)
+    {
+        buffer[run] = cycle_counter_to_ns(buffer[run], hz);
+    }
+    bench_stats_compute(buffer, runs, &transition_results[id].ns);
+}
+
+/*******************************************************************************
+* Function Name: bench_dpll_relock
+********************************************************************************
+* Summary:
+* Times dpll_lp_set_freq() from a disabled DPLL-LP: disable, configure, enable
+* and wait for the lock. The CM33 runs from the IHO through the unlocked PLL
+* path, so the cycles are counted at the IHO frequency.
+*
+*******************************************************************************/
+static void bench_dpll_relock(uint32_t runs)
+{
+    uint32_t run;
+    uint32_t begin;
+
+    for (run = 0U; run < runs; run++)
+    {
+        begin = cycle_counter_read();
+        dpll_lp_set_freq(TRANSITION_DPLL_FREQ_HZ);
+        samples[0][run] = cycle_counter_read() - begin;
+
+        Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
+    }
+
+    summarize(TRANSITION_DPLL_RELOCK, samples[0], runs, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: bench_dpll_switch
+********************************************************************************
+* Summary:
+* Times the same frequency change with the CPU clocks moved to the IHO path:
+* the time the CPU is held in dpll_lp_switch_begin(), and the time until
+* dpll_lp_switch_poll() has moved the clocks back after the lock. The CPU is
+* free to work for the difference.
+*
+*******************************************************************************/
+static void bench_dpll_switch(uint32_t runs)
+{
+    uint32_t run;
+    uint32_t begin;
+
+    for (run = 0U; run < runs; run++)
+    {
+        begin = cycle_counter_read();
+        dpll_lp_switch_begin(TRANSITION_DPLL_FREQ_HZ);
+        samples[0][run] = cycle_counter_read() - begin;
+
+        while (!dpll_lp_switch_poll())
+        {
+            __NOP();
+        }
+        samples[1][run] = cycle_counter_read() - begin;
+
+        Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
+    }
+
+    summarize(TRANSITION_DPLL_SWITCH_BEGIN, samples[0], runs, cpu_hz);
+    summarize(TRANSITION_DPLL_SWITCH_LOCK, samples[1], runs, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: bench_system_mode
+********************************************************************************
+* Summary:
+* Times round trips from HP to LP or ULP and back. The system mode change and
+* the RRAM voltage mode change are timed separately, in the order that
+* power_mode_apply() uses.
+*
+*******************************************************************************/
+static void bench_system_mode(uint32_t runs, bool ulp, transition_id_t first)
+{
+    const cy_en_rram_vmode_t vmode = ulp ? CY_RRAM_VMODE_ULP : CY_RRAM_VMODE_LP;
+    uint32_t run;
+    uint32_t begin;
+    cy_en_syspm_status_t status;
+
+    for (run = 0U; run < runs; run++)
+    {
+        begin = cycle_counter_read();
+        status = ulp ? Cy_SysPm_SystemEnterUlp() : Cy_SysPm_SystemEnterLp();
+        samples[0][run] = cycle_counter_read() - begin;
+        if (CY_SYSPM_SUCCESS != status)
+        {
+            handle_app_error();
+        }
+
+        begin = cycle_counter_read();
+        Cy_RRAM_SetVoltageMode(RRAMC0, vmode);
+        samples[1][run] = cycle_counter_read() - begin;
+
+        begin = cycle_counter_read();
+        status = Cy_SysPm_SystemEnterHp();
+        samples[2][run] = cycle_counter_read() - begin;
+        if (CY_SYSPM_SUCCESS != status)
+        {
+            handle_app_error();
+        }
+
+        begin = cycle_counter_read();
+        Cy_RRAM_SetVoltageMode(RRAMC0, CY_RRAM_VMODE_HP);
+        samples[3][run] = cycle_counter_read() - begin;
+    }
+
+    summarize(first, samples[0], runs, cpu_hz);
+    summarize((transition_id_t)(first + 1), samples[1], runs, cpu_hz);
+    summarize((transition_id_t)(first + 2), samples[2], runs, cpu_hz);
+    summarize((transition_id_t)(first + 3), samples[3], runs, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: bench_power_domains
+********************************************************************************
+* Summary:
+* Times pd_manager_set() turning PD1 and its domains off and on again, with
+* the CM55 in reset. The power-up waits for each domain to report ON.
+*
+*******************************************************************************/
+static void bench_power_domains(uint32_t runs)
+{
+    uint32_t run;
+    pd_manager_result_t result;
+
+    for (run = 0U; run < runs; run++)
+    {
+        (void)pd_manager_set(0U, &result);
+        samples[0][run] = result.cycles;
+
+        if (!pd_manager_set(PD_MANAGER_ALL, &result))
+        {
+            handle_app_error();
+        }
+        samples[1][run] = result.cycles;
+    }
+
+    summarize(TRANSITION_PD1_DOWN, samples[0], runs, cpu_hz);
+    summarize(TRANSITION_PD1_UP, samples[1], runs, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: bench_cm55_enable
+********************************************************************************
+* Summary:
+* Times Cy_SysEnableCM55() from reset. The call returns once the CM55 is out
+* of reset; the start-up of the CM55 application is not included. The CM55
+* gets the SIDH12A profile, whose CPU only waits for interrupts.
+*
+*******************************************************************************/
+static void bench_cm55_enable(uint32_t runs)
+{
+    uint32_t run;
+    uint32_t begin;
+
+    power_profile_post(power_profile_find(SIDH12A));
+
+    for (run = 0U; run < runs; run++)
+    {
+        Cy_SysDisableCM55(MXCM55);
+
+        begin = cycle_counter_read();
+        Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
+        samples[0][run] = cycle_counter_read() - begin;
+
+        Cy_SysLib_Delay(TRANSITION_CM55_RUN_MS);
+    }
+
+    summarize(TRANSITION_CM55_ENABLE, samples[0], runs, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: bench_cpu_wakeup
+********************************************************************************
+* Summary:
+* Times the wake-up from CPU Sleep or Deep Sleep: from the entry of the timer
+* interrupt that ends the low-power mode to the return of the low-power call.
+* The hardware wake-up before the interrupt is not counted; it shows in the
+* current trace between the marker phases.
+*
+*******************************************************************************/
+static void bench_cpu_wakeup(uint32_t runs, bool deep, transition_id_t id)
+{
+    uint32_t run;
+    uint32_t ticks;
+    uint32_t resume;
+
+    lp_timer_start(1U);
+    for (run = 0U; run < runs; run++)
+    {
+        ticks = lp_timer_ticks();
+        do
+        {
+            if (deep)
+            {
+                (void)Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+            }
+            else
+            {
+                (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+            }
+            resume = cycle_counter_read();
+        } while (lp_timer_ticks() == ticks);
+
+        samples[0][run] = resume - lp_timer_isr_cycles();
+    }
+    lp_timer_stop();
+
+    summarize(id, samples[0], runs, cpu_hz);
+}
+
+/*******************************************************************************
+* Function Name: transition_bench_run
+********************************************************************************
+* Summary:
+* Times every transition a number of times and stores the statistics in
+* transition_results. The CM33 runs from the IHO with the DPLL-LP off during
+* the benchmark, so the cycle count does not depend on the clocks under test.
+* The CM55 is left in reset and the system in HP with the boot clocks; call
+* it before the first power profile is applied.
+*
+* Parameters:
+*  runs: Repetitions of each transition, 1 to TRANSITION_BENCH_MAX_RUNS
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void transition_bench_run(uint32_t runs)
+{
+    if ((0U == runs) || (runs > TRANSITION_BENCH_MAX_RUNS))
+    {
+        handle_app_error();
+    }
+
+    Cy_SysClk_PllDisable(SRSS_DPLL_LP_0_PATH_NUM);
+    Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_NO_DIVIDE);
+    cpu_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+
+    bench_dpll_relock(runs);
+    bench_dpll_switch(runs);
+    bench_system_mode(runs, false, TRANSITION_SYSTEM_HP_TO_LP);
+    bench_system_mode(runs, true, TRANSITION_SYSTEM_HP_TO_ULP);
+    bench_power_domains(runs);
+    bench_cm55_enable(runs);
+    bench_cpu_wakeup(runs, false, TRANSITION_SLEEP_EXIT);
+    bench_cpu_wakeup(runs, true, TRANSITION_DEEP_SLEEP_EXIT);
+
+    Cy_SysDisableCM55(MXCM55);
+
+    /* Back to the boot clocks */
+    dpll_lp_set_freq(POWER_DPLL_FREQ_HP_HZ);
+    Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0,
+                              CY_SYSCLK_CLKHF_DIVIDE_BY_2);
+}
+
+#endif /* TRANSITION_BENCH_RUNS */
+
+/* [] END OF FILE */
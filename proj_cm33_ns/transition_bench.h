@@ -0,0 +1,94 @@
+/*******************************************************************************
+* File Name        : transition_bench.h
+*
+* Description      : This file provides the benchmark of the power
+*                    transitions: DPLL-LP relock, system power mode and RRAM
+*                    voltage mode changes, PD1 power-down and power-up, CM55
+*                    enable and CPU wake-up.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef TRANSITION_BENCH_H
+#define TRANSITION_BENCH_H
+
+#include <stdint.h>
+#include "bench_stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest number of runs per transition; sets the size of the sample buffer */
+#define TRANSITION_BENCH_MAX_RUNS   (256U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef enum
+{
+    TRANSITION_DPLL_RELOCK,
+    TRANSITION_DPLL_SWITCH_BEGIN,
+    TRANSITION_DPLL_SWITCH_LOCK,
+    TRANSITION_SYSTEM_HP_TO_LP,
+    TRANSITION_RRAM_HP_TO_LP,
+    TRANSITION_SYSTEM_LP_TO_HP,
+    TRANSITION_RRAM_LP_TO_HP,
+    TRANSITION_SYSTEM_HP_TO_ULP,
+    TRANSITION_RRAM_HP_TO_ULP,
+    TRANSITION_SYSTEM_ULP_TO_HP,
+    TRANSITION_RRAM_ULP_TO_HP,
+    TRANSITION_PD1_DOWN,
+    TRANSITION_PD1_UP,
+    TRANSITION_CM55_ENABLE,
+    TRANSITION_SLEEP_EXIT,
+    TRANSITION_DEEP_SLEEP_EXIT,
+    TRANSITION_COUNT
+} transition_id_t;
+
+typedef struct
+{
+    const char *name;
+    bench_stats_t ns;               /* Latency in nanoseconds */
+} transition_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern transition_result_t transition_results[TRANSITION_COUNT];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void transition_bench_run(uint32_t runs);
+
+#endif /* TRANSITION_BENCH_H */
+
+/* [] END OF FILE */
@@ -42,6 +42,7 @@
 
 #include "cy_pdl.h"
 #include "cybsp.h"
+#include "hibernate_bench.h"
 
 /*****************************************************************************
 * Macros
@@ -66,6 +67,9 @@ int main(void)
     cy_cmse_funcptr NonSecure_ResetHandler;
     cy_rslt_t result;
 
+    /* Hibernate wakeup timestamp, while the backup registers are secure */
+    hibernate_bench_mark_secure();
+
     /* Set up internal routing, pins, and clock-to-peripheral connections */
     result = cybsp_init();
 
@@ -40,28 +40,23 @@
 *******************************************************************************/
 #include "cybsp.h"
 #include "specs.h"
-#include "dhry.h"
+#include "workload.h"
+#include "duty_cycle.h"
+#include "power_profile.h"
+#include "ring_bench.h"
+#include "gating.h"
+#include "pd_manager.h"
+#include "cycle_counter.h"
+#include "event_trace.h"
 #include "cy_device.h"
-#include "ppu_v1.h"
-#include "cy_syspm_ppu.h"
-#include "cy_syspm_pdcm.h"
-
-/*******************************************************************************
-* Macros
-*******************************************************************************/
-#define DEEP_SLEEP_OFF_TOKEN        (0xB1)
-#define PERI_NUM                    (1U)
-#define GROUP_NUM                   (1U)
-#define SLAVE_NUM_0                 (0U)
-#define SLAVE_NUM_1                 (1U)
-#define SLAVE_NUM_2                 (2U)
 
 /*******************************************************************************
 * Function Name: main
 ********************************************************************************
 * Summary:
-* This is the main function for CM55 application. The programs executes the 
-* selected options, as configured in the specs.h header file.
+* This is the main function for CM55 application. It applies the CM55 part of
+* the power profile posted by the CM33 (by default the SPEC_ID configured in the
+* specs.h header file) and runs the workload of that profile.
 *
 * Parameters:
 * void
@@ -74,6 +69,9 @@ int main(void)
 {
 
     cy_rslt_t result = CY_RSLT_SUCCESS;
+    const power_profile_t *profile;
+    const char *cm55_workload;
+    uint32_t pd_domains;
 
     /* Initialize the device and board peripherals */ 
     result = cybsp_init();
@@ -86,79 +84,63 @@ int main(void)
 
     /* Enable global interrupts */
     __enable_irq();
- 
-#if defined(DISABLE_PD1)
-     /* Set deepsleep mode to deepsleep off */
-     Cy_SysPm_SetDeepSleepMode(CY_SYSPM_DEEPSLEEP_OFF); 
+
+    /* Free-running cycle counter of the CPU, see cycle_counter.h */
+    cycle_counter_init();
+
+    /* Event trace of the CM55, see specs.h */
+    event_trace_init();
+
+    /* Power profile selected by the CM33 */
+    profile = power_profile_received();
+    cm55_workload = profile->cm55_workload;
+    workload_register(&duty_cycle_workload);
+
+#if defined(RING_BENCH_MESSAGES)
+    /* The ring benchmark replaces the workload of every profile */
+    workload_register(&ring_bench_echo_workload);
+    cm55_workload = RING_BENCH_ECHO_WORKLOAD;
 #endif
  
-    /* Disable PeriGroupSlave */
-    Cy_SysClk_PeriGroupSlaveDeinit(PERI_NUM, GROUP_NUM,
-     SLAVE_NUM_0);
-    Cy_SysClk_PeriGroupSlaveDeinit(PERI_NUM, GROUP_NUM, 
-    SLAVE_NUM_1);
-    Cy_SysClk_PeriGroupSlaveDeinit(PERI_NUM, GROUP_NUM, 
-    SLAVE_NUM_2);
-    
-    /* Disable HF clocks which are not required */
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF3);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF4);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF5);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF6);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF7);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF9);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF10);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF11);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF12);
-    Cy_SysClk_ClkHfDisable(CY_CFG_SYSCLK_CLKHF13);
+    if (CY_SYSPM_MODE_DEEPSLEEP_OFF == power_profile_deep_sleep_mode(profile))
+    {
+        /* Set deepsleep mode to deepsleep off */
+        Cy_SysPm_SetDeepSleepMode(CY_SYSPM_DEEPSLEEP_OFF); 
+    }
+ 
+    /* Gate the clocks and peripheral slaves of the profile */
+    gating_apply(profile->gating);
 
-#if defined(DISABLE_CM55)
-    /* Disable APPCPU(CM55) power*/ 
-    (void)cy_pd_ppu_set_power_mode((struct ppu_v1_reg *)CY_PPU_APPCPU_BASE, 
-             (uint32_t)PPU_V1_MODE_OFF);    
-#endif
+    if (!workload_select(cm55_workload))
+    {
+        handle_app_error();
+    }
+
+    /* Power domains of the profile, turned off in dependency order */
+    if (profile->disable_pd1)
+    {
+        pd_domains = 0U;
+    }
+    else if (profile->disable_cm55)
+    {
+        pd_domains = PD_MANAGER_ALL & ~PD_MANAGER_DOMAIN(PD_DOMAIN_APPCPU);
+    }
+    else
+    {
+        pd_domains = PD_MANAGER_ALL;
+    }
+
+    if (!pd_manager_set(pd_domains, NULL))
+    {
+        handle_app_error();
+    }
 
-#if defined(DISABLE_PD1)  
-    /* Clear APPCPUSS and SYSCPU power domain dependency */
-    cy_pd_pdcm_clear_dependency(CY_PD_PDCM_APPCPUSS , 
-    CY_PD_PDCM_SYSCPU);
-    
-    /* Disable PD1 power*/  
-    (void)cy_pd_ppu_set_power_mode((struct ppu_v1_reg *)CY_PPU_PD1_BASE, 
-             (uint32_t)PPU_V1_MODE_OFF);
-    
-    /* Disable SoCMEM power */ 
-    (void)cy_pd_ppu_set_power_mode((struct ppu_v1_reg *)CY_PPU_SOCMEM_BASE, 
-             (uint32_t)PPU_V1_MODE_OFF);
-    
-    /* Disable APPCPUSS power */
-    (void)cy_pd_ppu_set_power_mode((struct ppu_v1_reg *)CY_PPU_APPCPUSS_BASE, 
-             (uint32_t)PPU_V1_MODE_OFF);
-    
-    /* Disable APPCPU(CM55) power */
-    (void)cy_pd_ppu_set_power_mode((struct ppu_v1_reg *)CY_PPU_APPCPU_BASE, 
-             (uint32_t)PPU_V1_MODE_OFF);
-#endif   
+    /* The CM33 waits for this before it changes the system power mode */
+    power_profile_signal_ready(profile);
    
     for (;;)
     {
-        /* Check if CM55 should enter CPU Sleep */
-        #if defined(CM55_SLEEP)
-        Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
-        
-        /* Check if CM55 should enter CPU Deep Sleep */
-        #elif defined(CM55_DEEP_SLEEP)
-        SRSS_PWR_HIBERNATE = (SRSS_PWR_HIBERNATE  | DEEP_SLEEP_OFF_TOKEN);
-        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
-        
-        /* Check if CM55 should run a while loop */
-        #elif defined(CM55_WHILE_LOOP)
-        while (true);
-        
-        /* Check if CM55 should run Dhrystone */
-        #elif defined(CM55_DHRYSTONE) 
-        dhrystone();
-        #endif
+        workload_step();
     }
 }
 
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* File Name        : ring_echo.c
+*
+* Description      : This file implements the CM55 side of the ring buffer
+*                    benchmark: a workload that drains the ring from the CM33
+*                    and sends echo messages back.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "ring.h"
+#include "ring_bench.h"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void ring_echo_run(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const workload_t ring_bench_echo_workload =
+{
+    RING_BENCH_ECHO_WORKLOAD, NULL, ring_echo_run, NULL
+};
+
+/*******************************************************************************
+* Function Name: ring_echo_run
+********************************************************************************
+* Summary:
+* Consumes every message waiting in the ring from the CM33. Echo messages are
+* sent back as received; the CM33 always drains its ring, so the push only
+* waits while the CM33 catches up.
+*
+*******************************************************************************/
+static void ring_echo_run(void)
+{
+    ring_channel_t *channel = ring_channel();
+    ring_msg_t msg;
+
+    while (ring_pop(&channel->to_cm55, &msg))
+    {
+        if (RING_BENCH_MSG_ECHO == msg.type)
+        {
+            while (!ring_push(&channel->to_cm33, &msg))
+            {
+                __NOP();
+            }
+        }
+    }
+    __NOP();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* File Name        : cycle_counter.h
+*
+* Description      : This file provides access to the CPU cycle counter used to
+*                    time the benchmark workloads
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include "cy_pdl.h"
+
+#if defined(HOST_BUILD)
+#include <time.h>
+
+/* The host build counts nanoseconds of CLOCK_MONOTONIC instead of cycles */
+#define CYCLE_COUNTER_HOST_HZ       (1000000000U)
+#endif
+
+/*******************************************************************************
+* Function Name: cycle_counter_init
+********************************************************************************
+* Summary:
+* Enables the DWT cycle counter (CYCCNT) of the calling CPU. main() of each
+* CPU calls it once at startup. The counter is never reset: it runs freely,
+* so that any code can time an interval as the difference of two readings,
+* also around code that times intervals of its own. It is 32 bits wide and
+* wraps after 2^32 core clock cycles (about 21 s at 200 MHz).
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void cycle_counter_init(void)
+{
+#if !defined(HOST_BUILD)
+    /* Enable the trace and debug blocks, which include the DWT unit */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: cycle_counter_read
+********************************************************************************
+* Summary:
+* Returns the current value of the DWT cycle counter. Differences between two
+* readings are valid across a single counter wrap when computed with unsigned
+* 32-bit arithmetic.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Current cycle count
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t cycle_counter_read(void)
+{
+#if defined(HOST_BUILD)
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * CYCLE_COUNTER_HOST_HZ) +
+                      (uint64_t)now.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: cycle_counter_to_ns
+********************************************************************************
+* Summary:
+* Converts a difference of two cycle counter readings to nanoseconds.
+*
+* Parameters:
+*  cycles: Cycle count
+*  cpu_hz: Clock of the CPU while the cycles were counted; not used by the
+*          host build, which counts nanoseconds
+*
+* Return:
+*  uint32_t: Nanoseconds, saturated to UINT32_MAX
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t cycle_counter_to_ns(uint32_t cycles, uint32_t cpu_hz)
+{
+#if defined(HOST_BUILD)
+    uint64_t ns = (uint64_t)cycles;
+
+    CY_UNUSED_PARAMETER(cpu_hz);
+#else
+    uint64_t ns = ((uint64_t)cycles * 1000000000U) / cpu_hz;
+#endif
+
+    return (ns > UINT32_MAX) ? UINT32_MAX : (uint32_t)ns;
+}
+
+/*******************************************************************************
+* Function Name: cycle_counter_to_us
+********************************************************************************
+* Summary:
+* Converts a difference of two cycle counter readings to microseconds, for
+* intervals too long for cycle_counter_to_ns().
+*
+* Parameters:
+*  cycles: Cycle count
+*  cpu_hz: Clock of the CPU while the cycles were counted; not used by the
+*          host build, which counts nanoseconds
+*
+* Return:
+*  uint32_t: Microseconds
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t cycle_counter_to_us(uint32_t cycles, uint32_t cpu_hz)
+{
+#if defined(HOST_BUILD)
+    CY_UNUSED_PARAMETER(cpu_hz);
+
+    return cycles / 1000U;
+#else
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / cpu_hz);
+#endif
+}
+
+#endif /* CYCLE_COUNTER_H */
+
+/* [] END OF FILE */
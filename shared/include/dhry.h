@@ -345,6 +345,15 @@
  ***************************************************************************
  */
 
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+                /* for strcpy, strcmp */
+#include "cy_pdl.h"
+#include "specs.h"
+                /* for CY_SECTION and the code placement options */
+
 /* Compiler and system dependent definitions: */
 
 
@@ -372,11 +381,6 @@
 
 /* General definitions: */
 
-#include <stdio.h>
-#include <string.h>
-#include <stdlib.h>
-                /* for strcpy, strcmp */
-
 #define Null 0 
                 /* Value of a Null pointer */
 #define true  1
@@ -411,15 +415,72 @@ typedef struct record
           } variant;
       } Rec_Type, *Rec_Pointer;
 
-void Proc_1(Rec_Pointer);
-void Proc_2(int *);
-void Proc_3(Rec_Pointer *);
-void Proc_4();
-void Proc_5();
-void Proc_6(Enumeration, Enumeration *);
-void Proc_7(int, int, int *);
-void Proc_8(Arr_1_Dim, Arr_2_Dim, int, int);
-Enumeration Func_1 (char, char);
-Boolean     Func_2 (Str_30, Str_30);
-Boolean     Func_3 (Enumeration);
+/* Code placement of the measured procedures (see specs.h): a linker     */
+/* section that the startup code copies to TCM or SRAM, or execute in   */
+/* place from RRAM. The placement is chosen at compile time.            */
+
+#if defined(DHRY_CODE_SECTION)
+#define DHRY_CODE               CY_SECTION(DHRY_CODE_SECTION)
+#define DHRY_CODE_PLACEMENT     DHRY_CODE_SECTION
+#else
+#define DHRY_CODE
+#define DHRY_CODE_PLACEMENT     "xip"
+#endif
+
+/* In a code section, the library calls of the loop would still run     */
+/* from RRAM: strcpy, strcmp and the memcpy of structure assignment go  */
+/* to copies in the section instead (dhry_2.c). Integer division is an  */
+/* instruction on the Cortex-M33 and M55 and needs no library helper.   */
+
+#if defined(DHRY_CODE_SECTION)
+char *dhry_strcpy (char *, const char *) DHRY_CODE;
+int   dhry_strcmp (const char *, const char *) DHRY_CODE;
+void  dhry_memcpy (void *, const void *, size_t) DHRY_CODE;
+#define strcpy(d, s)            dhry_strcpy (d, s)
+#define strcmp(s1, s2)          dhry_strcmp (s1, s2)
+#undef  structassign
+#define structassign(d, s)      dhry_memcpy (&(d), &(s), sizeof(d))
+#endif
+
+void Proc_1(Rec_Pointer) DHRY_CODE;
+void Proc_2(int *) DHRY_CODE;
+void Proc_3(Rec_Pointer *) DHRY_CODE;
+void Proc_4() DHRY_CODE;
+void Proc_5() DHRY_CODE;
+void Proc_6(Enumeration, Enumeration *) DHRY_CODE;
+void Proc_7(int, int, int *) DHRY_CODE;
+void Proc_8(Arr_1_Dim, Arr_2_Dim, int, int) DHRY_CODE;
+Enumeration Func_1 (char, char) DHRY_CODE;
+Boolean     Func_2 (Str_30, Str_30) DHRY_CODE;
+Boolean     Func_3 (Enumeration) DHRY_CODE;
 void dhrystone();
+
+/* Extensions for counted runs and score reporting: */
+
+#define DHRY_VAX_MIPS_DIVISOR   1757.0f
+                /* Dhrystones per second of the VAX 11/780 (1 MIPS) */
+
+typedef struct
+    {
+    uint32_t iterations;            /* Dhrystone iterations executed      */
+    uint32_t cycles;                /* CPU cycles spent in the iterations */
+    uint32_t clk_hz;                /* CPU clock frequency during the run */
+    float    dhrystones_per_sec;
+    float    dmips;
+    float    dmips_per_mhz;
+    } dhry_score_t;
+
+extern volatile uint32_t dhry_run_count;
+                /* Iterations executed since reset by dhrystone() and */
+                /* dhrystone_run(), both free-running and bounded;    */
+                /* dhrystone_run() continues after dhrystone_init()   */
+
+extern const char dhry_code_placement[];
+                /* DHRY_CODE_PLACEMENT of the image                   */
+
+void dhrystone_init(void);
+void dhrystone_run(uint32_t iterations);
+void dhrystone_measure(uint32_t iterations, uint32_t clk_hz,
+                       dhry_score_t *score);
+void dhrystone_score(uint32_t iterations, uint32_t cycles, uint32_t clk_hz,
+                     dhry_score_t *score);
@@ -0,0 +1,68 @@
+/* dhry_ctx.h */
+/*
+ ****************************************************************************
+ *
+ *                   "DHRYSTONE" Benchmark Program
+ *                   -----------------------------
+ *
+ *  Re-entrant variant of Dhrystone 2.1.
+ *
+ *  All state that dhry_1.c keeps in file-scope globals (Ptr_Glob,
+ *  Int_Glob, Bool_Glob, Ch_1_Glob, Ch_2_Glob, Arr_1_Glob, Arr_2_Glob and
+ *  the record arena) lives in a dhry_ctx_t instead, and Proc_1..Proc_8
+ *  and Func_1..Func_3 take the context as their first parameter. Any
+ *  number of instances can run at the same time, one per context.
+ *
+ *  The statements executed per iteration are those of dhry_1.c and
+ *  dhry_2.c, but global accesses become accesses through a pointer, so
+ *  scores of this variant are not comparable with published Dhrystone
+ *  results. Use dhrystone_run() from dhry_1.c for reference scores.
+ *
+ ****************************************************************************
+ */
+
+#ifndef DHRY_CTX_H
+#define DHRY_CTX_H
+
+#include "dhry.h"
+
+#define DHRY_CTX_REC_COUNT 2
+
+typedef struct
+    {
+    Rec_Pointer     Ptr_Glob;
+    Rec_Pointer     Next_Ptr_Glob;
+    int             Int_Glob;
+    Boolean         Bool_Glob;
+    char            Ch_1_Glob;
+    char            Ch_2_Glob;
+    int             Arr_1_Glob [50];
+    int             Arr_2_Glob [50] [50];
+    Rec_Type        Rec_Arena [DHRY_CTX_REC_COUNT];
+    uint32_t        Run_Count;      /* iterations executed on this context */
+    /* Locals of the last iteration, saved after the loop for the final  */
+    /* check that dhry_1.c prints as "should be" values                  */
+    int             Int_1_Loc;
+    int             Int_2_Loc;
+    int             Int_3_Loc;
+    Enumeration     Enum_Loc;
+    Str_30          Str_1_Loc;
+    Str_30          Str_2_Loc;
+    } dhry_ctx_t;
+
+void dhry_ctx_init (dhry_ctx_t *);
+void dhry_ctx_run (dhry_ctx_t *, uint32_t);
+
+void Proc_1_Ctx (dhry_ctx_t *, Rec_Pointer);
+void Proc_2_Ctx (dhry_ctx_t *, int *);
+void Proc_3_Ctx (dhry_ctx_t *, Rec_Pointer *);
+void Proc_4_Ctx (dhry_ctx_t *);
+void Proc_5_Ctx (dhry_ctx_t *);
+void Proc_6_Ctx (dhry_ctx_t *, Enumeration, Enumeration *);
+void Proc_7_Ctx (dhry_ctx_t *, int, int, int *);
+void Proc_8_Ctx (dhry_ctx_t *, Arr_1_Dim, Arr_2_Dim, int, int);
+Enumeration Func_1_Ctx (dhry_ctx_t *, char, char);
+Boolean     Func_2_Ctx (dhry_ctx_t *, Str_30, Str_30);
+Boolean     Func_3_Ctx (dhry_ctx_t *, Enumeration);
+
+#endif /* DHRY_CTX_H */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* File Name        : dhry_prof.h
+*
+* Description      : This file provides the optional cycle profiler of the
+*                    Dhrystone procedures. It keeps a log2 histogram of the
+*                    cycles of every call to Proc_1..Proc_8 and
+*                    Func_1..Func_3 in a fixed-size table.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DHRY_PROF_H
+#define DHRY_PROF_H
+
+#include <stdint.h>
+#include "cycle_counter.h"
+#include "specs.h"
+
+#if defined(HOST_BUILD) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bucket 0 counts calls of 0 cycles, bucket n calls of 2^(n-1) to 2^n - 1
+ * cycles and the last bucket all calls of 2^14 cycles or more */
+#define DHRY_PROF_BUCKETS           (16U)
+
+/* Times a procedure from entry to every exit. The cycles include the calls
+ * the procedure makes and the profiler work of those calls. */
+#if defined(DHRY_PROFILE)
+#define DHRY_PROF_ENTER()           uint32_t Prof_Begin = dhry_prof_now()
+#define DHRY_PROF_EXIT(id)          dhry_prof_record((id), \
+                                        dhry_prof_now() - Prof_Begin)
+#define DHRY_PROF_RETURN(id, value) do { DHRY_PROF_EXIT(id); \
+                                         return (value); } while (0)
+#else
+#define DHRY_PROF_ENTER()
+#define DHRY_PROF_EXIT(id)
+#define DHRY_PROF_RETURN(id, value) return (value)
+#endif
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef enum
+{
+    DHRY_PROF_PROC_1,
+    DHRY_PROF_PROC_2,
+    DHRY_PROF_PROC_3,
+    DHRY_PROF_PROC_4,
+    DHRY_PROF_PROC_5,
+    DHRY_PROF_PROC_6,
+    DHRY_PROF_PROC_7,
+    DHRY_PROF_PROC_8,
+    DHRY_PROF_FUNC_1,
+    DHRY_PROF_FUNC_2,
+    DHRY_PROF_FUNC_3,
+    DHRY_PROF_COUNT
+} dhry_prof_id_t;
+
+typedef struct
+{
+    uint32_t calls;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    uint32_t buckets[DHRY_PROF_BUCKETS];
+} dhry_prof_hist_t;
+
+typedef struct
+{
+    uint32_t overhead_cycles;       /* Subtracted from every call          */
+    dhry_prof_hist_t hist[DHRY_PROF_COUNT];
+} dhry_prof_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if defined(DHRY_PROFILE)
+extern dhry_prof_t dhry_prof;
+extern const char *const dhry_prof_names[DHRY_PROF_COUNT];
+#endif
+
+/*******************************************************************************
+* Function Name: dhry_prof_now
+********************************************************************************
+* Summary:
+* Returns the time stamp of the profiler: the DWT cycle counter on the device,
+* the time stamp counter on x86 hosts and nanoseconds on other hosts.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t dhry_prof_now(void)
+{
+#if defined(HOST_BUILD) && (defined(__x86_64__) || defined(__i386__))
+    return (uint32_t)__rdtsc();
+#else
+    return cycle_counter_read();
+#endif
+}
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void dhry_prof_reset(void);
+void dhry_prof_record(dhry_prof_id_t id, uint32_t cycles);
+
+#endif /* DHRY_PROF_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* File Name        : dpll_lp_table.h
+*
+* Description      : This file provides the table of precomputed DPLL-LP
+*                    settings. The table is generated on the host by
+*                    host/build/pll_gen, so that a frequency change only
+*                    writes the PLL registers and waits for lock.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DPLL_LP_TABLE_H
+#define DPLL_LP_TABLE_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Operating limits of the DPLL-LP that the generated settings respect. The
+ * output is input * (feedback + frac / 2^24) / (reference * output).
+ */
+#define DPLL_LP_MIN_REF_DIV         (1U)
+#define DPLL_LP_MAX_REF_DIV         (16U)
+#define DPLL_LP_MIN_FB_DIV          (16U)
+#define DPLL_LP_MAX_FB_DIV          (200U)
+#define DPLL_LP_MIN_OUT_DIV         (1U)
+#define DPLL_LP_MAX_OUT_DIV         (16U)
+#define DPLL_LP_MIN_PFD_HZ          (4000000U)
+#define DPLL_LP_MAX_PFD_HZ          (8000000U)
+#define DPLL_LP_MIN_DCO_HZ          (400000000U)
+#define DPLL_LP_MAX_DCO_HZ          (800000000U)
+#define DPLL_LP_FRAC_BITS           (24U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t freq_hz;               /* Output frequency                      */
+    uint8_t feedback_div;           /* Integer part of the feedback divider  */
+    uint8_t reference_div;          /* Reference divider                     */
+    uint8_t output_div;             /* Output divider                        */
+    uint32_t frac_div;              /* Fraction in 2^-24; 0: integer mode    */
+} dpll_lp_setting_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Settings sorted by frequency, see proj_cm33_ns/dpll_lp_table.c */
+extern const dpll_lp_setting_t dpll_lp_table[];
+extern const uint32_t dpll_lp_table_count;
+
+/*******************************************************************************
+* Function Name: dpll_lp_setting_freq_hz
+********************************************************************************
+* Summary:
+* Returns the output frequency that a setting gives from an input frequency,
+* rounded to the nearest hertz.
+*
+* Parameters:
+*  input_hz: Reference input frequency
+*  setting: DPLL-LP setting
+*
+* Return:
+*  uint32_t: Output frequency in hertz
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t dpll_lp_setting_freq_hz(uint32_t input_hz,
+                                                 const dpll_lp_setting_t *setting)
+{
+    uint64_t feedback = ((uint64_t)setting->feedback_div << DPLL_LP_FRAC_BITS) +
+                        setting->frac_div;
+    uint64_t divider = ((uint64_t)setting->reference_div *
+                        setting->output_div) << DPLL_LP_FRAC_BITS;
+
+    return (uint32_t)((((uint64_t)input_hz * feedback) + (divider / 2U)) /
+                      divider);
+}
+
+#endif /* DPLL_LP_TABLE_H */
+
+/* [] END OF FILE */
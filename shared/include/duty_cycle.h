@@ -0,0 +1,112 @@
+/*******************************************************************************
+* File Name        : duty_cycle.h
+*
+* Description      : This file provides the duty-cycle workload: the low-power
+*                    timer wakes the CPU once per period, the CPU runs a
+*                    burst of another workload and goes back to Sleep, Deep
+*                    Sleep or Deep Sleep-OFF.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DUTY_CYCLE_H
+#define DUTY_CYCLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hibernate_bench.h"
+#include "workload.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Backup registers that carry a Deep Sleep-OFF duty cycle across the warm
+ * boot of each wakeup, after those of the Hibernate benchmark */
+#define DUTY_CYCLE_BREG             (&HIBERNATE_BENCH_BREG[ \
+                                         HIBERNATE_BENCH_WORDS])
+
+/* Backup register words */
+#define DUTY_CYCLE_WORD_HEADER      (0U)    /* Magic and ticks to the burst */
+#define DUTY_CYCLE_WORD_PERIOD      (1U)    /* period_ms                    */
+#define DUTY_CYCLE_WORD_STEPS       (2U)    /* burst_steps                  */
+#define DUTY_CYCLE_WORD_BURSTS      (3U)    /* duty_cycle_bursts            */
+#define DUTY_CYCLE_WORD_OVERRUNS    (4U)    /* duty_cycle_overruns          */
+#define DUTY_CYCLE_WORDS            (5U)
+
+#define DUTY_CYCLE_MAGIC            (0xD0C5U)
+#define DUTY_CYCLE_TICKS_MASK       (0xFFFFUL)
+
+_Static_assert(EVENT_TRACE_BREG_WORDS + HIBERNATE_BENCH_WORDS +
+               DUTY_CYCLE_WORDS <= BACKUP_BREG_COUNT,
+               "Duty-cycle words exceed the backup registers");
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Deep Sleep-OFF is a CM33 depth: each wakeup is a warm boot, which main()
+ * hands to duty_cycle_resume() */
+typedef enum
+{
+    DUTY_CYCLE_SLEEP,
+    DUTY_CYCLE_DEEP_SLEEP,
+    DUTY_CYCLE_DEEP_SLEEP_OFF
+} duty_cycle_depth_t;
+
+typedef struct
+{
+    uint32_t period_ms;             /* Time from one burst start to the next */
+    uint32_t burst_steps;           /* Run calls of the workload per burst   */
+    duty_cycle_depth_t depth;       /* CPU state between bursts              */
+    const char *workload;           /* Registered workload run in bursts     */
+} duty_cycle_config_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Read when the duty-cycle workload is selected. Write it with the debugger
+ * or before the selection. */
+extern duty_cycle_config_t duty_cycle_config;
+
+/* Bursts run, and bursts that started late because the previous one did not
+ * fit in the period */
+extern volatile uint32_t duty_cycle_bursts;
+extern volatile uint32_t duty_cycle_overruns;
+
+extern const workload_t duty_cycle_workload;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool duty_cycle_resume(void);
+
+#endif /* DUTY_CYCLE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* File Name        : dvfs_governor.h
+*
+* Description      : This file provides the decision logic of the dynamic
+*                    voltage and frequency scaling (DVFS) governor. It only
+*                    picks an operating point from the measured load and has
+*                    no hardware access, so it also runs on the host.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef DVFS_GOVERNOR_H
+#define DVFS_GOVERNOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest number of operating points of a governor */
+#define DVFS_GOVERNOR_MAX_LEVELS    (8U)
+
+/* Load of a fully busy window */
+#define DVFS_GOVERNOR_FULL_LOAD     (1000U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t levels;                /* Number of operating points            */
+    const uint32_t *capacity;       /* Speed of each level, slowest first    */
+    uint32_t up_permille;           /* Load at or above which to step up     */
+    uint32_t down_permille;         /* Load at or below which to step down   */
+    uint32_t up_windows;            /* Windows above before stepping up      */
+    uint32_t down_windows;          /* Windows below before stepping down    */
+} dvfs_governor_config_t;
+
+typedef struct
+{
+    dvfs_governor_config_t config;
+    uint32_t level;                 /* Current operating point               */
+    uint32_t above;                 /* Consecutive windows at or above up    */
+    uint32_t below;                 /* Consecutive windows at or below down  */
+} dvfs_governor_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool dvfs_governor_init(dvfs_governor_t *gov,
+                        const dvfs_governor_config_t *config, uint32_t level);
+uint32_t dvfs_governor_update(dvfs_governor_t *gov, uint32_t load_permille);
+uint32_t dvfs_governor_project(const dvfs_governor_t *gov,
+                               uint32_t load_permille, uint32_t level);
+
+#endif /* DVFS_GOVERNOR_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,178 @@
+/*******************************************************************************
+* File Name        : event_trace.h
+*
+* Description      : This file provides the binary event trace: a ring buffer
+*                    of timestamped records per core that stays in SRAM
+*                    through Deep Sleep and is carried through Hibernate in
+*                    the backup registers.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef EVENT_TRACE_H
+#define EVENT_TRACE_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "specs.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Records of the ring buffer of a core; a power of two */
+#define EVENT_TRACE_RECORDS         (256U)
+
+/* First word of a log, and upper half of the first backup register word */
+#define EVENT_TRACE_MAGIC           (0x45565452UL)
+#define EVENT_TRACE_BREG_MAGIC      (0xE7A0U)
+
+/* Backup register words: magic and boot count, saved record count, records.
+ * EVENT_TRACE_BREG_WORDS words from EVENT_TRACE_BREG belong to the trace. */
+#define EVENT_TRACE_BREG_HEADER     (2U)
+#define EVENT_TRACE_RECORD_WORDS    (sizeof(event_trace_record_t) / 4U)
+#define EVENT_TRACE_BREG_WORDS      (EVENT_TRACE_BREG_HEADER + \
+                                     (EVENT_TRACE_BREG_RECORDS * \
+                                      EVENT_TRACE_RECORD_WORDS))
+
+/* Backup register words of the device */
+#define BACKUP_BREG_COUNT           (sizeof(BACKUP->BREG) / \
+                                     sizeof(BACKUP->BREG[0]))
+
+#define EVENT_TRACE_CORE_CM33       (0U)
+#define EVENT_TRACE_CORE_CM55       (1U)
+
+#if defined(COMPONENT_CM55)
+#define EVENT_TRACE_CORE            EVENT_TRACE_CORE_CM55
+#else
+#define EVENT_TRACE_CORE            EVENT_TRACE_CORE_CM33
+#endif
+
+/* Logs an event; nothing is compiled without EVENT_TRACE_ENABLE */
+#if defined(EVENT_TRACE_ENABLE)
+#define EVENT_TRACE(event, payload) event_trace_write((event), (payload))
+#else
+#define EVENT_TRACE(event, payload)
+#endif
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef enum
+{
+    EVENT_TRACE_BOOT = 1,           /* Payload: records taken back from the
+                                     * backup registers (CM33)              */
+    EVENT_TRACE_TRANSITION_BEGIN,   /* Payload: SPEC ID of the new profile   */
+    EVENT_TRACE_TRANSITION_END,     /* Payload: SPEC ID of the new profile   */
+    EVENT_TRACE_SYSTEM_MODE,        /* Payload: power_system_mode_t          */
+    EVENT_TRACE_DOMAINS,            /* Payload: domains on, see pd_manager.h */
+    EVENT_TRACE_CM55_START,
+    EVENT_TRACE_SLEEP_ENTER,
+    EVENT_TRACE_SLEEP_EXIT,
+    EVENT_TRACE_DEEP_SLEEP_ENTER,
+    EVENT_TRACE_DEEP_SLEEP_EXIT,
+    EVENT_TRACE_HIBERNATE,          /* Payload: records saved                */
+    EVENT_TRACE_EVENT_COUNT
+} event_trace_event_t;
+
+/* The timestamp is the cycle counter of the core, which stops in Deep Sleep */
+typedef struct
+{
+    uint32_t timestamp;
+    uint16_t event;
+    uint8_t core;
+    uint8_t boot;                   /* Boot count, carried through Hibernate */
+    uint32_t payload;
+} event_trace_record_t;
+
+_Static_assert(EVENT_TRACE_BREG_WORDS <= BACKUP_BREG_COUNT,
+               "EVENT_TRACE_BREG_RECORDS exceed the backup registers");
+
+/* Only the core that owns the log writes it. head runs freely; the newest
+ * EVENT_TRACE_RECORDS records are kept. */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t boot;
+    volatile uint32_t head;
+    uint32_t core;
+    event_trace_record_t records[EVENT_TRACE_RECORDS];
+} event_trace_log_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern event_trace_log_t event_trace_log;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void event_trace_init(void);
+void event_trace_hibernate(void);
+
+/*******************************************************************************
+* Function Name: event_trace_write
+********************************************************************************
+* Summary:
+* Appends a record to the log of the calling core, overwriting the oldest one
+* when the log is full. Interrupts are masked for the few stores of the
+* record, so thread and interrupt code of a core can both log without a lock.
+*
+* Parameters:
+*  event: Event ID
+*  payload: Event data
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void event_trace_write(event_trace_event_t event,
+                                       uint32_t payload)
+{
+    uint32_t primask = __get_PRIMASK();
+    event_trace_record_t *record;
+    uint32_t head;
+
+    __disable_irq();
+    head = event_trace_log.head;
+    record = &event_trace_log.records[head & (EVENT_TRACE_RECORDS - 1U)];
+    record->timestamp = cycle_counter_read();
+    record->event = (uint16_t)event;
+    record->core = (uint8_t)EVENT_TRACE_CORE;
+    record->boot = (uint8_t)event_trace_log.boot;
+    record->payload = payload;
+    event_trace_log.head = head + 1U;
+    __set_PRIMASK(primask);
+}
+
+#endif /* EVENT_TRACE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* File Name        : gating.h
+*
+* Description      : This file provides the clock and peripheral gating
+*                    manifests of the power profiles and the audit of the
+*                    CLK_HF clocks, PLL paths, peripheral slaves and PPU
+*                    domains that are on.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef GATING_H
+#define GATING_H
+
+#include <stdint.h>
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define GATING_HF(n)                (1UL << (n))
+#define GATING_PERI_SLAVE(n)        (1UL << (n))
+
+/* Peripheral group whose slaves the manifests gate, and its slave count */
+#define GATING_PERI_NUM             (1U)
+#define GATING_PERI_GROUP_NUM       (1U)
+#define GATING_PERI_SLAVE_COUNT     (3U)
+
+/* CLK_HF clocks of PD1 (CM55 and SOCMEM); the CM33 gates them after the CM55
+ * has turned PD1 off and ungates them before it boots the CM55 again */
+#define GATING_CM33_HF              (GATING_HF(CY_CFG_SYSCLK_CLKHF1) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF2))
+
+/* CLK_HF clocks and peripheral slaves that the CM55 gates when it boots */
+#define GATING_CM55_HF              (GATING_HF(CY_CFG_SYSCLK_CLKHF3) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF4) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF5) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF6) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF7) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF9) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF10) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF11) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF12) | \
+                                     GATING_HF(CY_CFG_SYSCLK_CLKHF13))
+#define GATING_CM55_PERI_SLAVES     (GATING_PERI_SLAVE(0U) | \
+                                     GATING_PERI_SLAVE(1U) | \
+                                     GATING_PERI_SLAVE(2U))
+
+/* Bits of gating_audit_t.ppu_on */
+#define GATING_PPU_PD1              (1UL << 0)
+#define GATING_PPU_SOCMEM           (1UL << 1)
+#define GATING_PPU_APPCPUSS         (1UL << 2)
+#define GATING_PPU_APPCPU           (1UL << 3)
+
+/* Length of the text of gating_audit_format(), with the terminator */
+#define GATING_AUDIT_TEXT_LEN       (64U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Resources that stay on in a profile; everything else that a core owns
+ * (GATING_CM33_x, GATING_CM55_x) is gated */
+typedef struct
+{
+    uint32_t hf_on;                 /* Bit n: CLK_HFn                        */
+    uint32_t peri_slaves_on;        /* Bit n: slave n of the gated group     */
+} gating_manifest_t;
+
+/* Resources read back as on */
+typedef struct
+{
+    uint32_t hf_on;                 /* Bit n: CLK_HFn                        */
+    uint32_t pll_on;                /* Bit n: PLL of clock path n            */
+    uint32_t peri_slaves_on;        /* Bit n: slave n of the gated group     */
+    uint32_t ppu_on;                /* GATING_PPU_x                          */
+    uint32_t hf_leaks;              /* On, but gated by the manifest         */
+    uint32_t peri_slave_leaks;
+} gating_audit_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* State left by the device configurator, and the states of the profiles
+ * with PD1 on and off */
+extern const gating_manifest_t gating_manifest_boot;
+extern const gating_manifest_t gating_manifest_pd1_on;
+extern const gating_manifest_t gating_manifest_pd1_off;
+
+/* Audit of the last profile applied, filled by the CM33 */
+extern gating_audit_t gating_audit;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void gating_apply(const gating_manifest_t *manifest);
+void gating_audit_read(const gating_manifest_t *manifest,
+                       gating_audit_t *audit);
+uint32_t gating_audit_format(const gating_audit_t *audit, char *text,
+                             uint32_t size);
+
+#endif /* GATING_H */
+
+/* [] END OF FILE */
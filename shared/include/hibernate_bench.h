@@ -0,0 +1,142 @@
+/*******************************************************************************
+* File Name        : hibernate_bench.h
+*
+* Description      : This file provides the Hibernate cycle benchmark: the
+*                    backup register layout shared by the secure and
+*                    non-secure CM33 projects and the latency results.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef HIBERNATE_BENCH_H
+#define HIBERNATE_BENCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "specs.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if !defined(HIBERNATE_BENCH_SLEEP_MS)
+#define HIBERNATE_BENCH_SLEEP_MS    (100U)
+#endif
+
+/* Backup registers of the benchmark, after those of the event trace */
+#define HIBERNATE_BENCH_BREG        (&EVENT_TRACE_BREG[EVENT_TRACE_BREG_WORDS])
+
+/* Latency histogram of the wakeup to the non-secure main(); the last bucket
+ * also counts the longer latencies */
+#define HIBERNATE_BENCH_BUCKETS     (8U)
+#define HIBERNATE_BENCH_BUCKET_US   (1000U)
+
+/* Backup register words */
+#define HIBERNATE_BENCH_WORD_HEADER (0U)    /* Magic and cycle count        */
+#define HIBERNATE_BENCH_WORD_WAKE   (1U)    /* Armed wakeup tick and mark   */
+#define HIBERNATE_BENCH_WORD_SECURE (2U)    /* Secure main() tick and mark  */
+#define HIBERNATE_BENCH_WORD_STATS  (3U)    /* Sum, min and max per interval */
+#define HIBERNATE_BENCH_WORD_HIST   (HIBERNATE_BENCH_WORD_STATS + \
+                                     (2U * HIBERNATE_INTERVAL_COUNT))
+#define HIBERNATE_BENCH_WORDS       (HIBERNATE_BENCH_WORD_HIST + \
+                                     (HIBERNATE_BENCH_BUCKETS / 2U))
+
+#define HIBERNATE_BENCH_MAGIC       (0x4B1BU)
+#define HIBERNATE_BENCH_MARK        (1UL << 16)
+#define HIBERNATE_BENCH_TICK_MASK   (0xFFFFUL)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef enum
+{
+    HIBERNATE_INTERVAL_BOOT,        /* Wakeup to secure main()              */
+    HIBERNATE_INTERVAL_SECURE,      /* Secure main() to non-secure main()   */
+    HIBERNATE_INTERVAL_WAKE,        /* Wakeup to non-secure main()          */
+    HIBERNATE_INTERVAL_COUNT
+} hibernate_interval_t;
+
+_Static_assert(EVENT_TRACE_BREG_WORDS + HIBERNATE_BENCH_WORDS <=
+               BACKUP_BREG_COUNT,
+               "Hibernate benchmark words exceed the backup registers");
+
+typedef struct
+{
+    const char *name;
+    uint32_t min_us;
+    uint32_t mean_us;
+    uint32_t max_us;
+} hibernate_interval_result_t;
+
+typedef struct
+{
+    uint32_t cycles;                /* Hibernate cycles measured            */
+    hibernate_interval_result_t intervals[HIBERNATE_INTERVAL_COUNT];
+    uint32_t histogram[HIBERNATE_BENCH_BUCKETS];
+} hibernate_bench_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern hibernate_bench_result_t hibernate_bench_results;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void hibernate_bench_wake(void);
+bool hibernate_bench_arm(uint32_t cycles);
+
+/*******************************************************************************
+* Function Name: hibernate_bench_mark_secure
+********************************************************************************
+* Summary:
+* Timestamps the secure main() of a Hibernate wakeup. The secure project
+* calls it first, before cybsp_init() makes the backup registers non-secure.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void hibernate_bench_mark_secure(void)
+{
+#if defined(HIBERNATE_BENCH_CYCLES)
+    HIBERNATE_BENCH_BREG[HIBERNATE_BENCH_WORD_SECURE] = HIBERNATE_BENCH_MARK |
+        (Cy_WDT_GetCount() & HIBERNATE_BENCH_TICK_MASK);
+#endif
+}
+
+#endif /* HIBERNATE_BENCH_H */
+
+/* [] END OF FILE */
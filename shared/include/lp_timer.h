@@ -0,0 +1,63 @@
+/*******************************************************************************
+* File Name        : lp_timer.h
+*
+* Description      : This file provides a periodic low-power timer on the
+*                    MCWDT of the calling CPU. It runs from CLK_LF and wakes
+*                    the CPU from Sleep and Deep Sleep.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef LP_TIMER_H
+#define LP_TIMER_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CLK_LF frequency and the longest period of the 16-bit MCWDT counter */
+#define LP_TIMER_CLK_LF_HZ          (32768U)
+#define LP_TIMER_MAX_PERIOD_MS      ((65536U * 1000U) / LP_TIMER_CLK_LF_HZ)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void lp_timer_start(uint32_t period_ms);
+void lp_timer_stop(void);
+uint32_t lp_timer_ticks(void);
+uint32_t lp_timer_isr_cycles(void);
+void lp_timer_wait_ms(uint32_t duration_ms, void (*step)(void));
+
+#endif /* LP_TIMER_H */
+
+/* [] END OF FILE */
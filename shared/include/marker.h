@@ -0,0 +1,87 @@
+/*******************************************************************************
+* File Name        : marker.h
+*
+* Description      : This file provides the marker pins that line up the
+*                    phases of the application with the current trace of an
+*                    external power analyzer.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef MARKER_H
+#define MARKER_H
+
+#include <stdint.h>
+#include "cybsp.h"
+#include "specs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Phase codes: 1 to 31 mark the dwell in the profile of that SPEC ID */
+#define MARKER_CODE_TRANSITION      (32U)
+#define MARKER_CODE_WORK_DONE       (33U)
+#define MARKER_CODE_SWEEP           (34U)
+#define MARKER_CODE_MAX             (63U)
+
+/* Width of the code pulses and of the gaps between them. Analyzers that
+ * sample their digital inputs at 100 kHz resolve 20 us reliably. */
+#if !defined(MARKER_PULSE_US)
+#define MARKER_PULSE_US             (20U)
+#endif
+
+#if defined(COMPONENT_CM55)
+#define MARKER_PIN_ITERATION        MARKER_PIN_ITERATION_CM55
+#else
+#define MARKER_PIN_ITERATION        MARKER_PIN_ITERATION_CM33
+#endif
+
+/* The iteration pin is low while an iteration runs and high between them */
+#if defined(MARKER_ENABLE) && defined(MARKER_ITERATION)
+#define MARKER_ITERATION_BEGIN()    Cy_GPIO_Clr(MARKER_PORT, \
+                                                MARKER_PIN_ITERATION)
+#define MARKER_ITERATION_END()      Cy_GPIO_Set(MARKER_PORT, \
+                                                MARKER_PIN_ITERATION)
+#else
+#define MARKER_ITERATION_BEGIN()
+#define MARKER_ITERATION_END()
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void marker_init(void);
+void marker_phase(uint32_t code);
+void marker_phase_end(void);
+
+#endif /* MARKER_H */
+
+/* [] END OF FILE */
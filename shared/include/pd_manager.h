@@ -0,0 +1,87 @@
+/*******************************************************************************
+* File Name        : pd_manager.h
+*
+* Description      : This file provides the power-domain manager. It models
+*                    the dependencies between the PD1 power domains and
+*                    applies the PPU and PDCM changes that bring a set of
+*                    domains on, in the order the dependencies require.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef PD_MANAGER_H
+#define PD_MANAGER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PD_MANAGER_DOMAIN(d)        (1UL << (d))
+
+/* Every managed domain: the state after reset */
+#define PD_MANAGER_ALL              (PD_MANAGER_DOMAIN(PD_DOMAIN_COUNT) - 1UL)
+
+/* Longest wait for a domain to report ON after its power-up */
+#define PD_MANAGER_TIMEOUT_US       (1000U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* Managed domains; a domain comes after the domain it depends on */
+typedef enum
+{
+    PD_DOMAIN_PD1,
+    PD_DOMAIN_SOCMEM,
+    PD_DOMAIN_APPCPUSS,
+    PD_DOMAIN_APPCPU,
+    PD_DOMAIN_COUNT
+} pd_domain_t;
+
+typedef struct
+{
+    uint32_t powered_down;          /* PD_MANAGER_DOMAIN(d) of each change   */
+    uint32_t powered_up;
+    uint32_t transitions;           /* PPU mode changes                      */
+    uint32_t cycles;                /* Cycle counter ticks of the changes    */
+} pd_manager_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t pd_manager_state(void);
+uint32_t pd_manager_closure(uint32_t domains_on);
+bool pd_manager_set(uint32_t domains_on, pd_manager_result_t *result);
+
+#endif /* PD_MANAGER_H */
+
+/* [] END OF FILE */
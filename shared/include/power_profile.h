@@ -0,0 +1,119 @@
+/*******************************************************************************
+* File Name        : power_profile.h
+*
+* Description      : This file provides the table of power profiles, one per
+*                    datasheet SPEC ID, that the CPUs apply at run time.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef POWER_PROFILE_H
+#define POWER_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "gating.h"
+#include "sram_retention.h"
+#include "specs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* DPLL-LP frequency set by the device configurator (HP mode) */
+#define POWER_DPLL_FREQ_HP_HZ       (400000000U)
+
+/* IPC channel whose data register passes the profile from CM33 to CM55. The
+ * channel must be unused by the other IPC users of the application.
+ */
+#define POWER_PROFILE_IPC_CHAN      (15U)
+
+/* Upper half of the mailbox value; a reset register reads as no profile */
+#define POWER_PROFILE_MAILBOX_MAGIC (0x50F10000U)
+#define POWER_PROFILE_MAILBOX_MASK  (0xFFFF0000U)
+
+/* IPC channel whose data register tells the CM33 that the CM55 has applied
+ * the profile. The CM55 writes the ready magic with the SPEC ID; the CM33
+ * clears it whenever it posts a profile.
+ */
+#define POWER_PROFILE_READY_CHAN    (14U)
+#define POWER_PROFILE_READY_MAGIC   (0x5EAD0000U)
+
+/* Polling interval of power_profile_wait_ready() */
+#define POWER_PROFILE_READY_POLL_US (10U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef enum
+{
+    POWER_SYSTEM_HP,
+    POWER_SYSTEM_LP,
+    POWER_SYSTEM_ULP
+} power_system_mode_t;
+
+typedef struct
+{
+    uint32_t spec_id;
+    const char *name;
+    power_system_mode_t system_mode;
+    uint32_t dpll_freq_hz;                  /* 0: DPLL-LP off, IHO bypass */
+    cy_en_clkhf_dividers_t hf0_divider;
+    cy_en_clkhf_dividers_t hf1_divider;
+    bool disable_pd1;
+    bool disable_cm55;
+    bool deepsleep_off;
+    const char *cm33_workload;
+    const char *cm55_workload;
+    const gating_manifest_t *gating;        /* Clocks and slaves left on */
+    const sram_retention_t *sram_retention; /* NULL: all SRAM retained   */
+    uint32_t marker_code;                   /* Phase code; 0: the SPEC ID */
+} power_profile_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t power_profile_count(void);
+const power_profile_t *power_profile_get(uint32_t index);
+const power_profile_t *power_profile_find(uint32_t spec_id);
+cy_en_syspm_deep_sleep_mode_t power_profile_deep_sleep_mode(
+    const power_profile_t *profile);
+uint32_t power_profile_marker_code(const power_profile_t *profile);
+void power_profile_post(const power_profile_t *profile);
+const power_profile_t *power_profile_received(void);
+void power_profile_signal_ready(const power_profile_t *profile);
+bool power_profile_wait_ready(const power_profile_t *profile,
+                              uint32_t timeout_us);
+
+#endif /* POWER_PROFILE_H */
+
+/* [] END OF FILE */
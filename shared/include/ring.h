@@ -0,0 +1,130 @@
+/*******************************************************************************
+* File Name        : ring.h
+*
+* Description      : This file provides a lock-free single-producer,
+*                    single-consumer ring buffer of fixed-size messages for
+*                    passing data between the CM33 and the CM55 through
+*                    shared SRAM.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef RING_H
+#define RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+#include "specs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Data cache line of the CM55. Head, tail and every slot start on a line of
+ * their own, so that cache maintenance of one never affects another. */
+#define RING_CACHE_LINE             (32U)
+
+/* Slots of a ring; a power of two */
+#define RING_SLOTS                  (64U)
+
+/* Words of message data after the type and sequence number */
+#define RING_MSG_DATA_WORDS         ((RING_CACHE_LINE / 4U) - 2U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* One message fills one cache line */
+typedef struct
+{
+    uint32_t type;
+    uint32_t seq;
+    uint32_t data[RING_MSG_DATA_WORDS];
+} ring_msg_t;
+
+/* The producer only writes head and the slots, the consumer only tail. Both
+ * indexes run freely and are taken modulo RING_SLOTS. */
+typedef struct
+{
+    volatile uint32_t head;
+    uint8_t head_pad[RING_CACHE_LINE - sizeof(uint32_t)];
+    volatile uint32_t tail;
+    uint8_t tail_pad[RING_CACHE_LINE - sizeof(uint32_t)];
+    ring_msg_t slots[RING_SLOTS];
+} ring_t;
+
+/* The two rings between the CPUs, placed at RING_SHARED_ADDR */
+typedef struct
+{
+    ring_t to_cm55;
+    ring_t to_cm33;
+} ring_channel_t;
+
+/* Layout that the cache maintenance of ring.c relies on */
+_Static_assert((RING_SLOTS & (RING_SLOTS - 1U)) == 0U,
+               "RING_SLOTS must be a power of two");
+_Static_assert(sizeof(ring_msg_t) == RING_CACHE_LINE,
+               "A message must fill one cache line");
+_Static_assert((offsetof(ring_t, tail) == RING_CACHE_LINE) &&
+               (offsetof(ring_t, slots) == (2U * RING_CACHE_LINE)),
+               "Head, tail and the slots must start on lines of their own");
+_Static_assert((sizeof(ring_t) % RING_CACHE_LINE) == 0U,
+               "Both rings of the channel must start on a cache line");
+
+/* The host places the shared memory at run time, aligned in cy_pdl_host.c */
+#if !defined(HOST_BUILD)
+_Static_assert((RING_SHARED_ADDR % RING_CACHE_LINE) == 0U,
+               "RING_SHARED_ADDR must be aligned to the cache line");
+#endif
+
+/*******************************************************************************
+* Function Name: ring_channel
+********************************************************************************
+* Summary:
+* Returns the rings in the shared SRAM. Both CPUs see them at the same
+* address.
+*
+*******************************************************************************/
+__STATIC_INLINE ring_channel_t *ring_channel(void)
+{
+    return (ring_channel_t *)RING_SHARED_ADDR;
+}
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void ring_init(ring_t *ring);
+bool ring_push(ring_t *ring, const ring_msg_t *msg);
+bool ring_pop(ring_t *ring, ring_msg_t *msg);
+
+#endif /* RING_H */
+
+/* [] END OF FILE */
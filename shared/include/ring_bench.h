@@ -0,0 +1,87 @@
+/*******************************************************************************
+* File Name        : ring_bench.h
+*
+* Description      : This file provides the benchmark of the inter-CPU ring
+*                    buffers. The CM33 streams and echoes messages through
+*                    the rings and the CM55 runs the echo workload.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef RING_BENCH_H
+#define RING_BENCH_H
+
+#include <stdint.h>
+#include "bench_stats.h"
+#include "workload.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Message types. The CM55 consumes stream messages and sends echo messages
+ * back unchanged. */
+#define RING_BENCH_MSG_STREAM       (1U)
+#define RING_BENCH_MSG_ECHO         (2U)
+
+/* Round trips timed per power mode, at most 256 */
+#define RING_BENCH_ROUND_TRIPS      (100U)
+
+/* Name of the CM55 echo workload */
+#define RING_BENCH_ECHO_WORKLOAD    "ring_echo"
+
+/* Power modes measured: HP, LP and ULP */
+#define RING_BENCH_MODES            (3U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    const char *mode;
+    uint32_t spec_id;               /* Profile applied for the mode        */
+    uint32_t messages_per_s;        /* Stream throughput CM33 to CM55      */
+    bench_stats_t one_way_ns;       /* Half of each round trip             */
+} ring_bench_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern ring_bench_result_t ring_bench_results[RING_BENCH_MODES];
+extern const workload_t ring_bench_echo_workload;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void ring_bench_run(uint32_t messages);
+
+#endif /* RING_BENCH_H */
+
+/* [] END OF FILE */
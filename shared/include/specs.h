@@ -43,8 +43,11 @@
  * operating conditions) and pick one of the SPEC IDs from the CPU currents 
  * table among the ones listed below as SPEC_ID constants. Set the #define SPEC_ID 
  * to the desired value. You can also set to CUSTOM and define your own settings.
+ * The host build (host/Makefile) can override it with "make SPEC_ID=<n>".
  */
+#if !defined(SPEC_ID)
 #define SPEC_ID (1)
+#endif
 
 /* SPEC IDs CONSTANTS (Do not alter these macros) */
 /* System Active Mode (HP, LP and ULP) */
@@ -72,12 +75,302 @@
 #define SIDHIBA (20)
 /* CUSTOM Configuration */
 #define CUSTOM  (21)
+/* System Deepsleep Mode with SRAM retention */
+#define SIDDSA  (22)
 /* END OF SPEC ID CONTSTANTS */
 
 /* Default DPLL Input frequency and timeout */
 #define DPLL_INTPUT_FREQ_HZ        (50000000U)
 #define DPLL_ENABLE_TIMEOUT_MS     (10000U)
 
+/* DPLL-LP switching:
+ * By default, a profile transition that changes the DPLL-LP frequency waits
+ * in dpll_lp_set_freq() until the DPLL-LP has relocked. Define
+ * DPLL_SWITCH_ON_IHO to move CLK_HF0 and CLK_HF1 to the IHO path instead,
+ * relock the DPLL-LP while the rest of the transition runs, and move them
+ * back at the end of the transition. Firmware that changes frequency
+ * itself can use dpll_lp_switch_begin() and dpll_lp_switch_poll()
+ * (proj_cm33_ns/power_mode.h) to keep working during the relock.
+ */
+/* #define DPLL_SWITCH_ON_IHO */
+
+/* Clock gating:
+ * Each power profile names a gating manifest (shared/include/gating.h) of
+ * the CLK_HF clocks and peripheral slaves that stay on. The CM55 gates its
+ * clocks and slaves when it boots, the CM33 gates the PD1 clocks. After each
+ * transition the CM33 reads back the CLK_HF clocks, PLL paths, peripheral
+ * slaves and PPU domains that are on into gating_audit, with the resources
+ * that are on although the manifest gates them as leaks. Define
+ * GATING_AUDIT_CHECK to stop in handle_app_error() on a leak.
+ */
+/* #define GATING_AUDIT_CHECK */
+
+/* Dhrystone run mode:
+ * Leave DHRY_ITERATIONS undefined to run Dhrystone free-running. The number of
+ * completed iterations is counted in dhry_run_count.
+ * Define DHRY_ITERATIONS to run bounded batches of that many iterations. Each
+ * batch is timed with the CPU cycle counter and converted to Dhrystones/s,
+ * DMIPS and DMIPS/MHz in the dhry_score variable (shared/source/workload.c).
+ */
+/* #define DHRY_ITERATIONS            (100000U) */
+
+/* Dhrystone record placement:
+ * The two Dhrystone records are taken from a static arena instead of the heap.
+ * Define the macro of a core with a linker section name to place its arena
+ * there, for example ".cy_dtcm" (CM55 DTCM) or ".cy_socmem_data" (SOCMEM).
+ * SOCMEM placements also need KEEP_SOCMEM so that CM33 main() leaves SOCMEM
+ * enabled, and cannot be combined with DISABLE_PD1. Leave the macro undefined
+ * to keep the arena with the other zero-initialized data of the core.
+ */
+/* #define CM33_DHRY_DATA_SECTION     ".cy_socmem_data" */
+/* #define CM55_DHRY_DATA_SECTION     ".cy_dtcm" */
+/* #define KEEP_SOCMEM */
+
+#if defined(COMPONENT_CM33) && defined(CM33_DHRY_DATA_SECTION)
+#define DHRY_DATA_SECTION          CM33_DHRY_DATA_SECTION
+#elif defined(COMPONENT_CM55) && defined(CM55_DHRY_DATA_SECTION)
+#define DHRY_DATA_SECTION          CM55_DHRY_DATA_SECTION
+#endif
+
+/* Dhrystone code placement:
+ * By default the Dhrystone loop and procedures execute in place from RRAM,
+ * whose access time grows when configure_system_power_mode() lowers its
+ * voltage mode in LP and ULP. Define the macro of a core with a linker
+ * section that the startup code copies to RAM to run them from there, for
+ * example ".cy_itcm" (CM55 ITCM) or ".cy_ramfunc" (CM33 SRAM); the section
+ * must exist in the linker script of the project. The section also gets
+ * copies of strcpy, strcmp and memcpy for the loop (shared/include/dhry.h).
+ * The placement is fixed at compile time. Combine it with
+ * CMxx_DHRY_DATA_SECTION above for the data, with DHRY_ITERATIONS or
+ * FREQ_SWEEP_DWELL_MS for the throughput, and with MARKER_ITERATION for the
+ * time of each iteration. The placement of an image is in the
+ * dhry_code_placement variable (shared/include/dhry.h), "xip" for RRAM.
+ */
+/* #define CM33_DHRY_CODE_SECTION     ".cy_ramfunc" */
+/* #define CM55_DHRY_CODE_SECTION     ".cy_itcm" */
+
+#if defined(COMPONENT_CM33) && defined(CM33_DHRY_CODE_SECTION)
+#define DHRY_CODE_SECTION          CM33_DHRY_CODE_SECTION
+#elif defined(COMPONENT_CM55) && defined(CM55_DHRY_CODE_SECTION)
+#define DHRY_CODE_SECTION          CM55_DHRY_CODE_SECTION
+#endif
+
+/* Dhrystone profiler:
+ * Define DHRY_PROFILE to time every call of Proc_1..Proc_8 and Func_1..Func_3
+ * with the CPU cycle counter. The calls of each procedure are counted in a
+ * log2 histogram of cycles in the dhry_prof variable (shared/source/
+ * dhry_prof.c), which is cleared whenever the dhrystone workload is selected,
+ * that is for every power profile. The profiler slows Dhrystone down; leave
+ * it undefined for DMIPS and current measurements.
+ */
+/* #define DHRY_PROFILE */
+
+/* Power profile sequence:
+ * Every SPEC ID above is also a power profile in shared/source/power_profile.c
+ * that the CM33 applies at run time. Define POWER_SEQUENCE with a list of SPEC
+ * IDs to step through them in one boot: each profile is applied and its
+ * workloads run for POWER_DWELL_MS before the next one. The last profile
+ * stays applied. SIDHIBA does not return and may only be the last entry.
+ * Leave POWER_SEQUENCE undefined to apply the profile of SPEC_ID only.
+ */
+/* #define POWER_SEQUENCE             SIDH12A, SIDL12B, SIDU12C */
+/* #define POWER_DWELL_MS             (10000U) */
+
+/* Phase markers:
+ * Define MARKER_ENABLE to drive marker pins that an external power analyzer
+ * records next to the current trace (shared/include/marker.h). The CM33 holds
+ * MARKER_PIN_PHASE high for each phase, such as a profile transition or the
+ * dwell in a profile, and sends the code of the phase as pulses on
+ * MARKER_PIN_CODE just before. Define MARKER_ITERATION as well to toggle the
+ * iteration pin of a core for every Dhrystone iteration. The markers cost
+ * current; leave them undefined for datasheet measurements.
+ */
+/* #define MARKER_ENABLE */
+/* #define MARKER_ITERATION */
+#define MARKER_PORT                (GPIO_PRT0)
+#define MARKER_PIN_ITERATION_CM33  (0U)
+#define MARKER_PIN_ITERATION_CM55  (1U)
+#define MARKER_PIN_PHASE           (2U)
+#define MARKER_PIN_CODE            (3U)
+
+/* Event trace:
+ * Define EVENT_TRACE_ENABLE to log power transitions, such as profile changes,
+ * power-domain changes and CPU Sleep and Deep Sleep, as binary records in a
+ * ring buffer per core (shared/include/event_trace.h). A record takes a few
+ * stores and no lock, so the trace can stay on during current measurements.
+ * The buffers stay in SRAM through Deep Sleep. Before Hibernate the CM33
+ * copies its newest EVENT_TRACE_BREG_RECORDS records to EVENT_TRACE_BREG, the
+ * backup registers, and takes them back into its log after the wakeup.
+ * Define the section macro of a core with a linker section that is not
+ * zeroed at startup to keep its log across a reset of that core as well.
+ * Dump event_trace_log of each core and the backup registers with a
+ * debugger, or run power_host -e, and decode them with build/event_decode.
+ */
+/* #define EVENT_TRACE_ENABLE */
+/* #define CM33_EVENT_TRACE_SECTION   ".cy_retained" */
+/* #define CM55_EVENT_TRACE_SECTION   ".cy_retained" */
+#define EVENT_TRACE_BREG           (BACKUP->BREG)
+#define EVENT_TRACE_BREG_RECORDS   (4U)
+
+#if defined(COMPONENT_CM33) && defined(CM33_EVENT_TRACE_SECTION)
+#define EVENT_TRACE_SECTION        CM33_EVENT_TRACE_SECTION
+#elif defined(COMPONENT_CM55) && defined(CM55_EVENT_TRACE_SECTION)
+#define EVENT_TRACE_SECTION        CM55_EVENT_TRACE_SECTION
+#endif
+
+/* Hibernate benchmark:
+ * Define HIBERNATE_BENCH_CYCLES to characterize the Hibernate cycle of the
+ * SIDHIBA profile. The CM33 arms the WDT as the Hibernate wakeup source,
+ * HIBERNATE_BENCH_SLEEP_MS (default 100 ms) after the entry, and enters
+ * Hibernate again after every wakeup until HIBERNATE_BENCH_CYCLES cycles are
+ * done; then it stays in Deep Sleep. The WDT counter, which keeps counting
+ * through Hibernate and the wakeup reset, timestamps the wakeup, the secure
+ * main() (proj_cm33_s) and the non-secure main(). The cycle count and the
+ * latency statistics are kept in HIBERNATE_BENCH_BREG, the backup registers
+ * after the EVENT_TRACE_BREG_WORDS of the event trace, and copied to
+ * hibernate_bench_results (shared/include/hibernate_bench.h) at each boot.
+ * Intervals longer than 2 s (16-bit WDT counter) are not measured correctly.
+ */
+/* #define HIBERNATE_BENCH_CYCLES     (100U) */
+/* #define HIBERNATE_BENCH_SLEEP_MS   (100U) */
+
+/* SIDDSA SRAM retention:
+ * SIDDSA is System Deep Sleep with PD1 off and only the SRAM macros of
+ * SIDDSA_SRAM0_RETAINED and SIDDSA_SRAM1_RETAINED (bit n: 64-KB macro n of
+ * the SRAM) powered; the CM33 powers the other macros down when it applies
+ * the profile and up again for the next one. Unlike SIDDSO, the CPUs resume
+ * from Deep Sleep with the peripherals and clocks restored. The macros that
+ * hold the CM33 stack and data and the memory shared with the CM55 must be
+ * retained (see the linker script); the CM33 stops with handle_app_error()
+ * otherwise. The masks are copied to sram_retention_siddsa (shared/include/
+ * sram_retention.h), which can be changed with the debugger to compare the
+ * Deep Sleep current of several retention sizes in one boot.
+ */
+#define SIDDSA_SRAM0_RETAINED      (0xFFU)
+#define SIDDSA_SRAM1_RETAINED      (0x00U)
+
+/* Linker map power-down:
+ * Define SRAM_MAP_POWER_DOWN to power down, at boot and in every profile, the
+ * SRAM macros and SOCMEM partitions that hold no section of any image. They
+ * are listed in sram_retention_used (shared/source/sram_map_table.c), which
+ * "make -C host sram_table" generates from the linker maps of proj_cm33_s,
+ * proj_cm33_ns and proj_cm55; build all three first and regenerate the table
+ * whenever their memory layout changes. The table in the tree retains every
+ * macro and partition until it is generated from the maps of the actual build.
+ * The SOCMEM partitions are powered down only with KEEP_SOCMEM, since SOCMEM
+ * is disabled otherwise. Memory used outside the linker sections, such as a
+ * debugger buffer, is lost.
+ */
+/* #define SRAM_MAP_POWER_DOWN */
+
+/* Transition benchmark:
+ * Define TRANSITION_BENCH_RUNS to time the power transitions at boot, before
+ * the first profile is applied: DPLL-LP relock, system and RRAM voltage mode
+ * changes, CM55 enable and the wake-up from CPU Sleep and Deep Sleep. Each
+ * transition is repeated TRANSITION_BENCH_RUNS times (at most 256) and its
+ * min, median, 99th percentile and max in nanoseconds are stored in the
+ * transition_results variable (proj_cm33_ns/transition_bench.c), to be read
+ * with the debugger.
+ */
+/* #define TRANSITION_BENCH_RUNS      (100U) */
+
+/* Ring buffer benchmark:
+ * Define RING_BENCH_MESSAGES to measure the inter-CPU rings of
+ * shared/include/ring.h at boot. The CM33 applies SIDH20A, SIDL20B and
+ * SIDU20C in turn, streams RING_BENCH_MESSAGES messages to the CM55 and times
+ * round trips through the CM55 echo workload. The messages per second and
+ * the one-way latency of each system power mode are stored in the
+ * ring_bench_results variable (proj_cm33_ns/ring_bench.c). The CM55 runs the
+ * echo workload in every profile while the benchmark is built in.
+ * The rings live at RING_SHARED_ADDR, the start of the memory region shared
+ * by both CPUs in the device configurator. The region is in SoCMEM, which
+ * the benchmark keeps powered.
+ */
+/* #define RING_BENCH_MESSAGES        (10000U) */
+#define RING_SHARED_ADDR           (CYMEM_CM33_0_m33_m55_shared_START)
+
+#if defined(RING_BENCH_MESSAGES) && !defined(KEEP_SOCMEM)
+#define KEEP_SOCMEM
+#endif
+
+/* Duty cycle:
+ * The duty_cycle workload (CM33_DUTY_CYCLE or CM55_DUTY_CYCLE below, or a
+ * profile workload) wakes the CPU every DUTY_CYCLE_PERIOD_MS with the
+ * low-power timer, runs DUTY_CYCLE_BURST_STEPS steps of DUTY_CYCLE_WORKLOAD
+ * and returns to DUTY_CYCLE_DEPTH: DUTY_CYCLE_SLEEP, DUTY_CYCLE_DEEP_SLEEP
+ * or, on the CM33 only, DUTY_CYCLE_DEEP_SLEEP_OFF. A Dhrystone step is 1000
+ * iterations. The values can be changed at run time in duty_cycle_config
+ * (shared/include/duty_cycle.h). The CM33 duty cycle uses the timer of the
+ * POWER_DWELL_MS wait and cannot be part of a power profile sequence. In
+ * Deep Sleep-OFF each wakeup is a warm boot; the CM33 resumes the duty cycle
+ * from the backup registers and runs the burst in the clocks of SPEC_ID
+ * without applying its profile again.
+ */
+#define DUTY_CYCLE_PERIOD_MS       (1000U)
+#define DUTY_CYCLE_BURST_STEPS     (1U)
+#define DUTY_CYCLE_DEPTH           (DUTY_CYCLE_DEEP_SLEEP)
+#define DUTY_CYCLE_WORKLOAD        "dhrystone"
+
+/* Race to idle versus pace to deadline:
+ * Define RACE_PACE_STEPS to compare power profiles on the same work at boot.
+ * For each profile of RACE_PACE_SPEC_IDS the CM33 runs RACE_PACE_ROUNDS
+ * batches of RACE_PACE_STEPS steps of RACE_PACE_WORKLOAD, one batch every
+ * RACE_PACE_DEADLINE_MS, and spends the rest of each deadline in Deep Sleep.
+ * With MARKER_ENABLE, the work of a batch is a phase with the SPEC ID as code
+ * and the idle time after it a work_done phase. The work times are stored in
+ * race_pace_results (proj_cm33_ns/race_pace.c). The default profiles keep
+ * the CM55 off: the CM33 at 200 MHz (HP), 70 MHz (LP) and 50 MHz (ULP).
+ */
+/* #define RACE_PACE_STEPS            (100U) */
+#define RACE_PACE_WORKLOAD         "dhrystone"
+#define RACE_PACE_DEADLINE_MS      (1000U)
+#define RACE_PACE_ROUNDS           (10U)
+#define RACE_PACE_SPEC_IDS         SIDH10A, SIDL10B, SIDU10C
+
+/* Frequency sweep:
+ * Define FREQ_SWEEP_DWELL_MS to measure the CM33 performance at several
+ * clock frequencies at boot. From the FREQ_SWEEP_BASE_SPEC_ID profile, the
+ * CM33 walks the system power modes of FREQ_SWEEP_MODES and, in each, the
+ * DPLL-LP frequencies of FREQ_SWEEP_FREQS (0: DPLL-LP off, IHO). A
+ * frequency is skipped in a mode if it is above the fastest profile of
+ * that mode; the points use the CLK_HF dividers of that profile. At each
+ * point Dhrystone runs for FREQ_SWEEP_DWELL_MS; the sweep counts its
+ * iterations and takes no other workload. With MARKER_ENABLE, each point is
+ * a sweep phase (code 34). The clocks and iterations of the points are
+ * stored in freq_sweep_results (proj_cm33_ns/freq_sweep.h).
+ */
+/* #define FREQ_SWEEP_DWELL_MS        (1000U) */
+#define FREQ_SWEEP_BASE_SPEC_ID    (SIDH10A)
+#define FREQ_SWEEP_MODES           POWER_SYSTEM_HP, POWER_SYSTEM_LP, \
+                                   POWER_SYSTEM_ULP
+#define FREQ_SWEEP_FREQS           0U, 50000000U, 70000000U, 100000000U, \
+                                   140000000U, 200000000U, 300000000U, \
+                                   400000000U
+
+/* DVFS governor:
+ * The dvfs workload (CM33_DVFS below) runs one window every DVFS_WINDOW_MS:
+ * the number of DVFS_WORKLOAD steps of the next entry of DVFS_LOAD_TRACE,
+ * then CPU Sleep. The busy time of the window is the load. After
+ * DVFS_UP_WINDOWS windows at or above DVFS_UP_PERMILLE the governor moves to
+ * the slowest profile of DVFS_SPEC_IDS (slowest first) that brings the load
+ * below DVFS_UP_PERMILLE; after DVFS_DOWN_WINDOWS windows at or below
+ * DVFS_DOWN_PERMILLE it moves to a slower profile if the load stays below
+ * DVFS_UP_PERMILLE there. Only the system power mode and the clocks of the
+ * profiles are used; the CM55 keeps running the workload of the applied
+ * profile. The counts are in dvfs_windows, dvfs_transitions, dvfs_overruns
+ * and dvfs_level_windows (proj_cm33_ns/dvfs.h). The CM33 DVFS workload uses
+ * the timer of the POWER_DWELL_MS wait and cannot be part of a power profile
+ * sequence.
+ */
+#define DVFS_WINDOW_MS             (100U)
+#define DVFS_WORKLOAD              "dhrystone"
+#define DVFS_LOAD_TRACE            1U, 1U, 1U, 4U, 16U, 16U, 16U, 8U, 2U, 1U
+#define DVFS_SPEC_IDS              SIDU20C, SIDL20B, SIDH20A
+#define DVFS_UP_PERMILLE           (800U)
+#define DVFS_DOWN_PERMILLE         (300U)
+#define DVFS_UP_WINDOWS            (1U)
+#define DVFS_DOWN_WINDOWS          (3U)
+
 #if(SPEC_ID != CUSTOM)
 
 #if (SPEC_ID == SIDH00A) || (SPEC_ID == SIDH01A)
@@ -136,6 +429,11 @@
     #define CM55_DEEP_SLEEP
     #define DISABLE_PD1
     #define DEEPSLEEP_OFF
+#elif (SPEC_ID == SIDDSA)
+    #define CM33_DEEP_SLEEP
+    #define CM55_DEEP_SLEEP
+    #define DISABLE_PD1
+    #define SRAM_PARTIAL_RETENTION
 #endif /* if(SPEC_ID != CUSTOM) */
 
 #elif(SPEC_ID == CUSTOM)
@@ -159,12 +457,20 @@
 /* #define DISABLE_PD1 */
 /* #define CM55_DEEP_SLEEP */
 
+/* Option to retain only the SRAM macros of SIDDSA_SRAM0_RETAINED and
+ * SIDDSA_SRAM1_RETAINED, see above, and to use Deep Sleep instead of
+ * Deep Sleep-OFF while PD1 is disabled:
+ */
+/* #define SRAM_PARTIAL_RETENTION */
+
 /* Options for the CM33 super loop:
  * CM33_DHRYSTONE: Run Dhrystone benchmark on CM33 CPU
  * CM33_WHILE_LOOP: Run infinite loop and keep CM33 CPU active
  * CM33_SLEEP: Put CM33 CPU in low-power sleep mode
  * CM33_DEEP_SLEEP: Put CM33 CPU in deep sleep mode 
  * CM33_HIBERNATE: Put the System to Hibernate mode 
+ * CM33_DUTY_CYCLE: Wake CM33 periodically for a burst of work, see above
+ * CM33_DVFS: Run a load trace and scale the power mode with it, see above
  */
 #define CM33_DHRYSTONE
 
@@ -175,6 +481,7 @@
  * CM55_WHILE_LOOP: Run infinite loop and keep CM55 CPU active
  * CM55_SLEEP: Put CM55 CPU in low-power sleep mode
  * CM55_DEEP_SLEEP: Put CM55 CPU in deep sleep mode 
+ * CM55_DUTY_CYCLE: Wake CM55 periodically for a burst of work, see above
  */
 #if !defined(DISABLE_PD1)
 #define CM55_DHRYSTONE
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* File Name        : sram_retention.h
+*
+* Description      : This file provides the SRAM retention of the power
+*                    profiles: the SRAM macros that stay powered, and so keep
+*                    their content through Deep Sleep, and the macros that are
+*                    powered down. It also provides the SRAM and SOCMEM that
+*                    the images use, generated from their linker maps.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef SRAM_RETENTION_H
+#define SRAM_RETENTION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* SRAM0 and SRAM1 of the CM33 are contiguous from SRAM_RETENTION_BASE, each
+ * made of SRAM_RETENTION_MACROS macros */
+#define SRAM_RETENTION_BASE         (CY_SRAM0_BASE)
+#define SRAM_RETENTION_SRAMS        (2U)
+#define SRAM_RETENTION_MACROS       (8U)
+#define SRAM_RETENTION_MACRO_SIZE   (0x10000U)
+#define SRAM_RETENTION_ALL_MACROS   ((1UL << SRAM_RETENTION_MACROS) - 1U)
+
+/* SOCMEM, in PD1, is made of SRAM_RETENTION_SOCMEM_PARTITIONS partitions */
+#define SRAM_RETENTION_SOCMEM_BASE  (CY_SOCMEM_RAM_BASE)
+#define SRAM_RETENTION_SOCMEM_PARTITIONS    (10U)
+#define SRAM_RETENTION_PARTITION_SIZE       (0x80000U)
+#define SRAM_RETENTION_ALL_PARTITIONS       \
+    ((1UL << SRAM_RETENTION_SOCMEM_PARTITIONS) - 1U)
+
+/* Address bit of the secure aliases of the SRAM and SOCMEM */
+#define SRAM_RETENTION_SECURE_ALIAS (0x10000000UL)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    uint32_t retained[SRAM_RETENTION_SRAMS];    /* Bit n: macro n of SRAMx */
+    uint32_t socmem_retained;       /* Bit n: SOCMEM partition n           */
+} sram_retention_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Retention of SIDDSA, from SIDDSA_SRAMx_RETAINED in specs.h. It is read when
+ * the profile is applied, so it can be changed with the debugger. */
+extern sram_retention_t sram_retention_siddsa;
+
+/* SRAM macros and SOCMEM partitions that hold a section of an image, from
+ * shared/source/sram_map_table.c. Only these are powered when
+ * SRAM_MAP_POWER_DOWN is defined. */
+extern const sram_retention_t sram_retention_used;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool sram_retention_apply(const sram_retention_t *retention);
+void sram_retention_socmem_apply(void);
+
+#endif /* SRAM_RETENTION_H */
+
+/* [] END OF FILE */
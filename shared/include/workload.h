@@ -0,0 +1,127 @@
+/*******************************************************************************
+* File Name        : workload.h
+*
+* Description      : This file provides the registry of the workloads that the
+*                    CPU super-loops execute. A workload is selected at run
+*                    time by name instead of with the CM33_ and CM55_ macros.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "specs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of workloads in the registry of one CPU */
+#define WORKLOAD_MAX                (16U)
+
+/* Index written to workload_request when no switch is pending */
+#define WORKLOAD_NONE               (0xFFFFFFFFU)
+
+/* Workloads selected by the CM33_ and CM55_ options of specs.h. No selection
+ * (or CMxx_WHILE_LOOP) keeps the CPU active in the super-loop.
+ */
+#if defined(CM33_SLEEP)
+#define WORKLOAD_CM33_SPECS         "sleep"
+#elif defined(CM33_DEEP_SLEEP)
+#define WORKLOAD_CM33_SPECS         "deep_sleep"
+#elif defined(CM33_HIBERNATE)
+#define WORKLOAD_CM33_SPECS         "hibernate"
+#elif defined(CM33_DHRYSTONE)
+#define WORKLOAD_CM33_SPECS         "dhrystone"
+#elif defined(CM33_DUTY_CYCLE)
+#define WORKLOAD_CM33_SPECS         "duty_cycle"
+#elif defined(CM33_DVFS)
+#define WORKLOAD_CM33_SPECS         "dvfs"
+#else
+#define WORKLOAD_CM33_SPECS         "while_loop"
+#endif
+
+#if defined(CM55_SLEEP)
+#define WORKLOAD_CM55_SPECS         "sleep"
+#elif defined(CM55_DEEP_SLEEP)
+#define WORKLOAD_CM55_SPECS         "deep_sleep"
+#elif defined(CM55_DHRYSTONE)
+#define WORKLOAD_CM55_SPECS         "dhrystone"
+#elif defined(CM55_DUTY_CYCLE)
+#define WORKLOAD_CM55_SPECS         "duty_cycle"
+#else
+#define WORKLOAD_CM55_SPECS         "while_loop"
+#endif
+
+/* Workload that the super-loop starts with when none was selected */
+#if defined(COMPONENT_CM55)
+#define WORKLOAD_DEFAULT            WORKLOAD_CM55_SPECS
+#else
+#define WORKLOAD_DEFAULT            WORKLOAD_CM33_SPECS
+#endif
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+/* A named workload. The run hook executes one bounded step and returns so that
+ * the super-loop can switch workloads; init and teardown may be NULL.
+ */
+typedef struct
+{
+    const char *name;
+    void (*init)(void);
+    void (*run)(void);
+    void (*teardown)(void);
+} workload_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Registry index to switch to on the next step. Write it with the debugger. */
+extern volatile uint32_t workload_request;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void workload_register(const workload_t *workload);
+uint32_t workload_count(void);
+const workload_t *workload_get(uint32_t index);
+const workload_t *workload_find(const char *name);
+const workload_t *workload_current(void);
+bool workload_select(const char *name);
+void workload_step(void);
+
+#endif /* WORKLOAD_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* File Name        : bench_stats.c
+*
+* Description      : This file implements the summary statistics of benchmark
+*                    samples.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "bench_stats.h"
+
+/*******************************************************************************
+* Function Name: rank
+********************************************************************************
+* Summary:
+* Returns the index of the nearest-rank percentile in a sorted set.
+*
+*******************************************************************************/
+static uint32_t rank(uint32_t count, uint32_t percent)
+{
+    uint32_t position = ((count * percent) + 99U) / 100U;
+
+    return (0U == position) ? 0U : (position - 1U);
+}
+
+/*******************************************************************************
+* Function Name: bench_stats_compute
+********************************************************************************
+* Summary:
+* Sorts the samples in place and summarizes them. The median and the 99th
+* percentile use the nearest-rank method, so they are always one of the
+* samples. Benchmarks keep their sample sets small, so an insertion sort is
+* used.
+*
+* Parameters:
+*  samples: Samples, sorted on return
+*  count: Number of samples; 0 gives all-zero statistics
+*  stats: Statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void bench_stats_compute(uint32_t *samples, uint32_t count,
+                         bench_stats_t *stats)
+{
+    uint32_t index;
+    uint32_t slot;
+    uint32_t value;
+
+    memset(stats, 0, sizeof(*stats));
+    if (0U == count)
+    {
+        return;
+    }
+
+    for (index = 1U; index < count; index++)
+    {
+        value = samples[index];
+        for (slot = index; (slot > 0U) && (samples[slot - 1U] > value); slot--)
+        {
+            samples[slot] = samples[slot - 1U];
+        }
+        samples[slot] = value;
+    }
+
+    stats->count = count;
+    stats->min = samples[0];
+    stats->median = samples[rank(count, 50U)];
+    stats->p99 = samples[rank(count, 99U)];
+    stats->max = samples[count - 1U];
+}
+
+/* [] END OF FILE */
@@ -17,6 +17,10 @@
  */
 
 #include "dhry.h"
+#include "cycle_counter.h"
+#include "specs.h"
+#include "marker.h"
+#include "dhry_prof.h"
 
 /* Global Variables: */
 
@@ -31,6 +35,17 @@ int             Arr_2_Glob [50] [50];
 
 //extern char     *malloc ();
 
+  /* Static record arena replacing malloc (): Ptr_Glob and Next_Ptr_Glob */
+  /* point into it, optionally placed in a named section (see specs.h)   */
+
+#define DHRY_REC_COUNT 2
+
+#if defined(DHRY_DATA_SECTION)
+static Rec_Type Rec_Arena [DHRY_REC_COUNT] CY_SECTION(DHRY_DATA_SECTION);
+#else
+static Rec_Type Rec_Arena [DHRY_REC_COUNT];
+#endif
+
 
   /* forward declaration necessary since Enumeration may not simply be int */
 
@@ -45,23 +60,22 @@ int             Arr_2_Glob [50] [50];
 
 /* end of variables for time measurement */
 
+volatile uint32_t dhry_run_count = 0;
 
-void dhrystone(void)
-{
-    /* No return function */
-        One_Fifty       Int_1_Loc;
-  REG   One_Fifty       Int_2_Loc;
-        One_Fifty       Int_3_Loc;
-  REG   char            Ch_Index;
-        Enumeration     Enum_Loc;
-        Str_30          Str_1_Loc;
-        Str_30          Str_2_Loc;
-  REG   int             Run_Index = 0;
+const char dhry_code_placement[] = DHRY_CODE_PLACEMENT;
 
-  /* Initializations */
+  /* The loop is placed with the procedures it calls (see dhry.h) */
 
-  Next_Ptr_Glob = (Rec_Pointer) malloc (sizeof (Rec_Type));
-  Ptr_Glob = (Rec_Pointer) malloc (sizeof (Rec_Type));
+static void dhry_loop (uint32_t Number_Of_Runs) DHRY_CODE;
+
+
+void dhrystone_init (void)
+/******************/
+    /* initializes the global records and arrays once, before the   */
+    /* first call of dhrystone_run () or dhrystone_measure ()       */
+{
+  Next_Ptr_Glob = &Rec_Arena [1];
+  Ptr_Glob = &Rec_Arena [0];
 
   Ptr_Glob->Ptr_Comp                    = Next_Ptr_Glob;
   Ptr_Glob->Discr                       = Ident_1;
@@ -69,17 +83,36 @@ void dhrystone(void)
   Ptr_Glob->variant.var_1.Int_Comp      = 40;
   strcpy (Ptr_Glob->variant.var_1.Str_Comp, 
           "DHRYSTONE PROGRAM, SOME STRING");
-  strcpy (Str_1_Loc, "DHRYSTONE PROGRAM, 1'ST STRING");
 
   Arr_2_Glob [8][7] = 10;
         /* Was missing in published program. Without this statement,    */
         /* Arr_2_Glob [8][7] would have an undefined value.             */
         /* Warning: With 16-Bit processors and Number_Of_Runs > 32000,  */
         /* overflow may occur for this array element.                   */
+}
+
 
-    while(1)
+static void dhry_loop (uint32_t Number_Of_Runs)
+/******************/
+    /* Number_Of_Runs == 0: run forever; the globals keep their     */
+    /* state from the previous call, only the locals are set here   */
+{
+        One_Fifty       Int_1_Loc;
+  REG   One_Fifty       Int_2_Loc;
+        One_Fifty       Int_3_Loc;
+  REG   char            Ch_Index;
+        Enumeration     Enum_Loc;
+        Str_30          Str_1_Loc;
+        Str_30          Str_2_Loc;
+  REG   uint32_t        Run_Index;
+
+  strcpy (Str_1_Loc, "DHRYSTONE PROGRAM, 1'ST STRING");
+
+  for (Run_Index = 1;
+       (Number_Of_Runs == 0) || (Run_Index <= Number_Of_Runs);
+       ++Run_Index)
   {
-   // CY_SET_REG32( 0x40320000 , 0x00000000 ); // P00
+    MARKER_ITERATION_BEGIN ();
     Proc_5();
     Proc_4();
       /* Ch_1_Glob == 'A', Ch_2_Glob == 'B', Bool_Glob == true */
@@ -120,11 +153,76 @@ void dhrystone(void)
       /* Int_1_Loc == 1, Int_2_Loc == 13, Int_3_Loc == 7 */
     Proc_2 (&Int_1_Loc);
       /* Int_1_Loc == 5 */
-   // CY_SET_REG32( 0x40320000 , 0x00000001 ); // P00
+    dhry_run_count += 1;
+    MARKER_ITERATION_END ();
   } /* loop "for Run_Index" */    
 }
 
 
+void dhrystone(void)
+{
+    /* No return function */
+  dhrystone_init ();
+  dhry_loop (0);
+}
+
+
+void dhrystone_run (uint32_t Number_Of_Runs)
+/******************/
+    /* runs exactly Number_Of_Runs iterations and returns; call     */
+    /* dhrystone_init () once first                                 */
+{
+  if (Number_Of_Runs != 0)
+    dhry_loop (Number_Of_Runs);
+}
+
+
+void dhrystone_measure (uint32_t Number_Of_Runs, uint32_t Clk_Hz,
+                        dhry_score_t *Score)
+/******************/
+    /* times a bounded run as the difference of two readings of the */
+    /* free-running DWT cycle counter, which it never resets, so    */
+    /* callers can time across it; the run must complete within     */
+    /* 2^32 cycles (about 21 s at 200 MHz)                          */
+{
+  uint32_t Begin_Cycles;
+  uint32_t End_Cycles;
+
+  Begin_Cycles = cycle_counter_read ();
+  dhrystone_run (Number_Of_Runs);
+  End_Cycles = cycle_counter_read ();
+
+  dhrystone_score (Number_Of_Runs, End_Cycles - Begin_Cycles, Clk_Hz, Score);
+}
+
+
+void dhrystone_score (uint32_t Number_Of_Runs, uint32_t Cycles,
+                      uint32_t Clk_Hz, dhry_score_t *Score)
+/******************/
+    /* converts an iteration count into Dhrystones/s, DMIPS and     */
+    /* DMIPS/MHz; usable for free-running mode with deltas of       */
+    /* dhry_run_count taken over a known number of cycles           */
+{
+  Score->iterations         = Number_Of_Runs;
+  Score->cycles             = Cycles;
+  Score->clk_hz             = Clk_Hz;
+  Score->dhrystones_per_sec = 0.0f;
+  Score->dmips              = 0.0f;
+  Score->dmips_per_mhz      = 0.0f;
+
+  if (Cycles == 0)
+    return;
+
+  /* Cycles per iteration is independent of the clock, so DMIPS/MHz */
+  /* needs no time base; the clock only scales it to DMIPS.         */
+  Score->dmips_per_mhz = ((float) Number_Of_Runs * 1000000.0f)
+                         / ((float) Cycles * DHRY_VAX_MIPS_DIVISOR);
+  Score->dhrystones_per_sec = ((float) Number_Of_Runs * (float) Clk_Hz)
+                              / (float) Cycles;
+  Score->dmips = Score->dhrystones_per_sec / DHRY_VAX_MIPS_DIVISOR;
+}
+
+
 void Proc_1 (Ptr_Val_Par)
 /******************/
 
@@ -135,6 +233,7 @@ REG Rec_Pointer Ptr_Val_Par;
                                         /* == Ptr_Glob_Next */
   /* Local variable, initialized with Ptr_Val_Par->Ptr_Comp,    */
   /* corresponds to "rename" in Ada, "with" in Pascal           */
+  DHRY_PROF_ENTER ();
   
   structassign (*Ptr_Val_Par->Ptr_Comp, *Ptr_Glob); 
   Ptr_Val_Par->variant.var_1.Int_Comp = 5;
@@ -156,6 +255,7 @@ REG Rec_Pointer Ptr_Val_Par;
   }
   else /* not executed */
     structassign (*Ptr_Val_Par, *Ptr_Val_Par->Ptr_Comp);
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_1);
 } /* Proc_1 */
 
 
@@ -168,6 +268,7 @@ One_Fifty   *Int_Par_Ref;
 {
   One_Fifty  Int_Loc;  
   Enumeration   Enum_Loc = Ident_1;
+  DHRY_PROF_ENTER ();
 
   Int_Loc = *Int_Par_Ref + 10;
   do /* executed once */
@@ -179,6 +280,7 @@ One_Fifty   *Int_Par_Ref;
       Enum_Loc = Ident_1;
     } /* if */
   while (Enum_Loc != Ident_1); /* true */
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_2);
 } /* Proc_2 */
 
 
@@ -190,11 +292,13 @@ void Proc_3 (Ptr_Ref_Par)
 Rec_Pointer *Ptr_Ref_Par;
 
 {
+  DHRY_PROF_ENTER ();
   if (Ptr_Glob != Null) {
     /* then, executed */
     *Ptr_Ref_Par = Ptr_Glob->Ptr_Comp;
   Proc_7 (10, Int_Glob, &Ptr_Glob->variant.var_1.Int_Comp);
 }
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_3);
 } /* Proc_3 */
 
 
@@ -203,10 +307,12 @@ void Proc_4 () /* without parameters */
     /* executed once */
 {
   Boolean Bool_Loc;
+  DHRY_PROF_ENTER ();
 
   Bool_Loc = Ch_1_Glob == 'A';
   Bool_Glob = Bool_Loc | Bool_Glob;
   Ch_2_Glob = 'B';
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_4);
 } /* Proc_4 */
 
 
@@ -214,8 +320,10 @@ void Proc_5 () /* without parameters */
 /*******/
     /* executed once */
 {
+  DHRY_PROF_ENTER ();
   Ch_1_Glob = 'A';
   Bool_Glob = false;
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_5);
 } /* Proc_5 */
 
 
@@ -17,6 +17,7 @@
  */
 
 #include "dhry.h"
+#include "dhry_prof.h"
 
 #ifndef REG
 #define REG
@@ -36,6 +37,7 @@ void Proc_6 (Enum_Val_Par, Enum_Ref_Par)
 Enumeration  Enum_Val_Par;
 Enumeration *Enum_Ref_Par;
 {
+  DHRY_PROF_ENTER ();
   *Enum_Ref_Par = Enum_Val_Par;
   if (! Func_3 (Enum_Val_Par))
     /* then, not executed */
@@ -59,6 +61,7 @@ Enumeration *Enum_Ref_Par;
       *Enum_Ref_Par = Ident_3;
       break;
   } /* switch */
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_6);
 } /* Proc_6 */
 
 
@@ -76,9 +79,11 @@ One_Fifty       Int_2_Par_Val;
 One_Fifty      *Int_Par_Ref;
 {
   One_Fifty Int_Loc;
+  DHRY_PROF_ENTER ();
 
   Int_Loc = Int_1_Par_Val + 2;
   *Int_Par_Ref = Int_2_Par_Val + Int_Loc;
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_7);
 } /* Proc_7 */
 
 
@@ -94,6 +99,7 @@ int             Int_2_Par_Val;
 {
   REG One_Fifty Int_Index;
   REG One_Fifty Int_Loc;
+  DHRY_PROF_ENTER ();
 
   Int_Loc = Int_1_Par_Val + 5;
   Arr_1_Par_Ref [Int_Loc] = Int_2_Par_Val;
@@ -104,6 +110,7 @@ int             Int_2_Par_Val;
   Arr_2_Par_Ref [Int_Loc] [Int_Loc-1] += 1;
   Arr_2_Par_Ref [Int_Loc+20] [Int_Loc] = Arr_1_Par_Ref [Int_Loc];
   Int_Glob = 5;
+  DHRY_PROF_EXIT (DHRY_PROF_PROC_8);
 } /* Proc_8 */
 
 
@@ -119,16 +126,17 @@ Capital_Letter   Ch_2_Par_Val;
 {
   Capital_Letter        Ch_1_Loc;
   Capital_Letter        Ch_2_Loc;
+  DHRY_PROF_ENTER ();
 
   Ch_1_Loc = Ch_1_Par_Val;
   Ch_2_Loc = Ch_1_Loc;
   if (Ch_2_Loc != Ch_2_Par_Val)
     /* then, executed */
-    return (Ident_1);
+    DHRY_PROF_RETURN (DHRY_PROF_FUNC_1, Ident_1);
   else  /* not executed */
   {
     Ch_1_Glob = Ch_1_Loc;
-    return (Ident_2);
+    DHRY_PROF_RETURN (DHRY_PROF_FUNC_1, Ident_2);
    }
 } /* Func_1 */
 
@@ -144,6 +152,7 @@ Str_30  Str_2_Par_Ref;
 {
   REG One_Thirty        Int_Loc;
       Capital_Letter    Ch_Loc;
+  DHRY_PROF_ENTER ();
 
   Int_Loc = 2;
   while (Int_Loc <= 2) /* loop body executed once */
@@ -159,7 +168,7 @@ Str_30  Str_2_Par_Ref;
     Int_Loc = 7;
   if (Ch_Loc == 'R')
     /* then, not executed */
-    return (true);
+    DHRY_PROF_RETURN (DHRY_PROF_FUNC_2, true);
   else /* executed */
   {
     if (strcmp (Str_1_Par_Ref, Str_2_Par_Ref) > 0)
@@ -167,10 +176,10 @@ Str_30  Str_2_Par_Ref;
     {
       Int_Loc += 7;
       Int_Glob = Int_Loc;
-      return (true);
+      DHRY_PROF_RETURN (DHRY_PROF_FUNC_2, true);
     }
     else /* executed */
-      return (false);
+      DHRY_PROF_RETURN (DHRY_PROF_FUNC_2, false);
   } /* if Ch_Loc */
 } /* Func_2 */
 
@@ -182,11 +191,50 @@ Boolean Func_3 (Enum_Par_Val)
 Enumeration Enum_Par_Val;
 {
   Enumeration Enum_Loc;
+  DHRY_PROF_ENTER ();
 
   Enum_Loc = Enum_Par_Val;
   if (Enum_Loc == Ident_3)
     /* then, executed */
-    return (true);
+    DHRY_PROF_RETURN (DHRY_PROF_FUNC_3, true);
   else /* not executed */
-    return (false);
+    DHRY_PROF_RETURN (DHRY_PROF_FUNC_3, false);
 } /* Func_3 */
+
+
+#if defined(DHRY_CODE_SECTION)
+
+        /* Copies of the library calls of the loop, placed in the  */
+        /* code section with it (see dhry.h)                       */
+
+char *dhry_strcpy (char *Dst, const char *Src)
+{
+  char *Dst_Loc = Dst;
+
+  while ((*Dst_Loc++ = *Src++) != '\0')
+    ;
+  return Dst;
+}
+
+
+int dhry_strcmp (const char *Str_1, const char *Str_2)
+{
+  while ((*Str_1 != '\0') && (*Str_1 == *Str_2))
+  {
+    Str_1++;
+    Str_2++;
+  }
+  return (int) (unsigned char) *Str_1 - (int) (unsigned char) *Str_2;
+}
+
+
+void dhry_memcpy (void *Dst, const void *Src, size_t Len)
+{
+  char       *Dst_Loc = Dst;
+  const char *Src_Loc = Src;
+
+  while (Len--)
+    *Dst_Loc++ = *Src_Loc++;
+}
+
+#endif
@@ -0,0 +1,197 @@
+/* dhry_ctx_1.c */
+/*
+ ****************************************************************************
+ *
+ *                   "DHRYSTONE" Benchmark Program
+ *                   -----------------------------
+ *
+ *  Re-entrant variant of dhry_1.c, see dhry_ctx.h.
+ *
+ ****************************************************************************
+ */
+
+#include "dhry_ctx.h"
+
+#ifndef REG
+#define REG
+        /* REG becomes defined as empty */
+        /* i.e. no register variables   */
+#endif
+
+
+void dhry_ctx_init (dhry_ctx_t *Ctx)
+/******************/
+    /* prepares a context for its first run */
+{
+  memset (Ctx, 0, sizeof (*Ctx));
+  Ctx->Next_Ptr_Glob = &Ctx->Rec_Arena [1];
+  Ctx->Ptr_Glob = &Ctx->Rec_Arena [0];
+}
+
+
+void dhry_ctx_run (dhry_ctx_t *Ctx, uint32_t Number_Of_Runs)
+/******************/
+    /* runs Number_Of_Runs iterations on the given context */
+{
+        One_Fifty       Int_1_Loc;
+  REG   One_Fifty       Int_2_Loc;
+        One_Fifty       Int_3_Loc;
+  REG   char            Ch_Index;
+        Enumeration     Enum_Loc;
+        Str_30          Str_1_Loc;
+        Str_30          Str_2_Loc;
+  REG   uint32_t        Run_Index;
+
+  /* Initializations */
+
+  Ctx->Ptr_Glob->Ptr_Comp                    = Ctx->Next_Ptr_Glob;
+  Ctx->Ptr_Glob->Discr                       = Ident_1;
+  Ctx->Ptr_Glob->variant.var_1.Enum_Comp     = Ident_3;
+  Ctx->Ptr_Glob->variant.var_1.Int_Comp      = 40;
+  strcpy (Ctx->Ptr_Glob->variant.var_1.Str_Comp,
+          "DHRYSTONE PROGRAM, SOME STRING");
+  strcpy (Str_1_Loc, "DHRYSTONE PROGRAM, 1'ST STRING");
+
+  Ctx->Arr_2_Glob [8][7] = 10;
+
+  for (Run_Index = 1; Run_Index <= Number_Of_Runs; ++Run_Index)
+  {
+    Proc_5_Ctx (Ctx);
+    Proc_4_Ctx (Ctx);
+      /* Ch_1_Glob == 'A', Ch_2_Glob == 'B', Bool_Glob == true */
+    Int_1_Loc = 2;
+    Int_2_Loc = 3;
+    strcpy (Str_2_Loc, "DHRYSTONE PROGRAM, 2'ND STRING");
+    Enum_Loc = Ident_2;
+    Ctx->Bool_Glob = ! Func_2_Ctx (Ctx, Str_1_Loc, Str_2_Loc);
+      /* Bool_Glob == 1 */
+    while (Int_1_Loc < Int_2_Loc)  /* loop body executed once */
+    {
+      Int_3_Loc = 5 * Int_1_Loc - Int_2_Loc;
+        /* Int_3_Loc == 7 */
+      Proc_7_Ctx (Ctx, Int_1_Loc, Int_2_Loc, &Int_3_Loc);
+        /* Int_3_Loc == 7 */
+      Int_1_Loc += 1;
+    } /* while */
+      /* Int_1_Loc == 3, Int_2_Loc == 3, Int_3_Loc == 7 */
+    Proc_8_Ctx (Ctx, Ctx->Arr_1_Glob, Ctx->Arr_2_Glob, Int_1_Loc, Int_3_Loc);
+      /* Int_Glob == 5 */
+    Proc_1_Ctx (Ctx, Ctx->Ptr_Glob);
+    for (Ch_Index = 'A'; Ch_Index <= Ctx->Ch_2_Glob; ++Ch_Index)
+                             /* loop body executed twice */
+    {
+      if (Enum_Loc == Func_1_Ctx (Ctx, Ch_Index, 'C'))
+          /* then, not executed */
+        {
+        Proc_6_Ctx (Ctx, Ident_1, &Enum_Loc);
+        strcpy (Str_2_Loc, "DHRYSTONE PROGRAM, 3'RD STRING");
+        Int_2_Loc = Run_Index;
+        Ctx->Int_Glob = Run_Index;
+        }
+    }
+      /* Int_1_Loc == 3, Int_2_Loc == 3, Int_3_Loc == 7 */
+    Int_2_Loc = Int_2_Loc * Int_1_Loc;
+    Int_1_Loc = Int_2_Loc / Int_3_Loc;
+      /* Int_1_Loc == 1, Int_2_Loc == 13, Int_3_Loc == 7 */
+    Proc_2_Ctx (Ctx, &Int_1_Loc);
+      /* Int_1_Loc == 5 */
+  } /* loop "for Run_Index" */
+
+  if (Number_Of_Runs > 0U)
+  {
+    Ctx->Int_1_Loc = Int_1_Loc;
+    Ctx->Int_2_Loc = Int_2_Loc;
+    Ctx->Int_3_Loc = Int_3_Loc;
+    Ctx->Enum_Loc = Enum_Loc;
+    strcpy (Ctx->Str_1_Loc, Str_1_Loc);
+    strcpy (Ctx->Str_2_Loc, Str_2_Loc);
+  }
+  Ctx->Run_Count += Number_Of_Runs;
+}
+
+
+void Proc_1_Ctx (dhry_ctx_t *Ctx, REG Rec_Pointer Ptr_Val_Par)
+/******************/
+    /* executed once */
+{
+  REG Rec_Pointer Next_Record = Ptr_Val_Par->Ptr_Comp;
+                                        /* == Ptr_Glob_Next */
+
+  structassign (*Ptr_Val_Par->Ptr_Comp, *Ctx->Ptr_Glob);
+  Ptr_Val_Par->variant.var_1.Int_Comp = 5;
+  Next_Record->variant.var_1.Int_Comp
+        = Ptr_Val_Par->variant.var_1.Int_Comp;
+  Next_Record->Ptr_Comp = Ptr_Val_Par->Ptr_Comp;
+  Proc_3_Ctx (Ctx, &Next_Record->Ptr_Comp);
+    /* Ptr_Val_Par->Ptr_Comp->Ptr_Comp
+                        == Ptr_Glob->Ptr_Comp */
+  if (Next_Record->Discr == Ident_1)
+    /* then, executed */
+  {
+    Next_Record->variant.var_1.Int_Comp = 6;
+    Proc_6_Ctx (Ctx, Ptr_Val_Par->variant.var_1.Enum_Comp,
+           &Next_Record->variant.var_1.Enum_Comp);
+    Next_Record->Ptr_Comp = Ctx->Ptr_Glob->Ptr_Comp;
+    Proc_7_Ctx (Ctx, Next_Record->variant.var_1.Int_Comp, 10,
+           &Next_Record->variant.var_1.Int_Comp);
+  }
+  else /* not executed */
+    structassign (*Ptr_Val_Par, *Ptr_Val_Par->Ptr_Comp);
+} /* Proc_1_Ctx */
+
+
+void Proc_2_Ctx (dhry_ctx_t *Ctx, One_Fifty *Int_Par_Ref)
+/******************/
+    /* executed once */
+    /* *Int_Par_Ref == 1, becomes 4 */
+{
+  One_Fifty  Int_Loc;
+  Enumeration   Enum_Loc = Ident_1;
+
+  Int_Loc = *Int_Par_Ref + 10;
+  do /* executed once */
+    if (Ctx->Ch_1_Glob == 'A')
+      /* then, executed */
+    {
+      Int_Loc -= 1;
+      *Int_Par_Ref = Int_Loc - Ctx->Int_Glob;
+      Enum_Loc = Ident_1;
+    } /* if */
+  while (Enum_Loc != Ident_1); /* true */
+} /* Proc_2_Ctx */
+
+
+void Proc_3_Ctx (dhry_ctx_t *Ctx, Rec_Pointer *Ptr_Ref_Par)
+/******************/
+    /* executed once */
+    /* Ptr_Ref_Par becomes Ptr_Glob */
+{
+  if (Ctx->Ptr_Glob != Null)
+    /* then, executed */
+  {
+    *Ptr_Ref_Par = Ctx->Ptr_Glob->Ptr_Comp;
+    Proc_7_Ctx (Ctx, 10, Ctx->Int_Glob,
+                &Ctx->Ptr_Glob->variant.var_1.Int_Comp);
+  }
+} /* Proc_3_Ctx */
+
+
+void Proc_4_Ctx (dhry_ctx_t *Ctx)
+/*******/
+    /* executed once */
+{
+  Boolean Bool_Loc;
+
+  Bool_Loc = Ctx->Ch_1_Glob == 'A';
+  Ctx->Bool_Glob = Bool_Loc | Ctx->Bool_Glob;
+  Ctx->Ch_2_Glob = 'B';
+} /* Proc_4_Ctx */
+
+
+void Proc_5_Ctx (dhry_ctx_t *Ctx)
+/*******/
+    /* executed once */
+{
+  Ctx->Ch_1_Glob = 'A';
+  Ctx->Bool_Glob = false;
+} /* Proc_5_Ctx */
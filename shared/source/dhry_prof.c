@@ -0,0 +1,148 @@
+/*******************************************************************************
+* File Name        : dhry_prof.c
+*
+* Description      : This file implements the cycle histograms of the
+*                    Dhrystone procedures. It is empty unless DHRY_PROFILE is
+*                    defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "dhry_prof.h"
+
+#if defined(DHRY_PROFILE)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Enter and exit pairs timed to measure the profiler overhead */
+#define DHRY_PROF_CALIBRATION_RUNS  (16U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+dhry_prof_t dhry_prof;
+
+const char *const dhry_prof_names[DHRY_PROF_COUNT] =
+{
+    "Proc_1", "Proc_2", "Proc_3", "Proc_4", "Proc_5", "Proc_6", "Proc_7",
+    "Proc_8", "Func_1", "Func_2", "Func_3"
+};
+
+/*******************************************************************************
+* Function Name: dhry_prof_reset
+********************************************************************************
+* Summary:
+* Clears the histograms, enables the cycle counter and measures the cycles of
+* an empty enter and exit pair, which dhry_prof_record() subtracts from every
+* call. The dhrystone workload calls it when it is selected, so every power
+* profile starts with empty histograms.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void dhry_prof_reset(void)
+{
+    uint32_t run;
+    uint32_t begin;
+    uint32_t cycles;
+    uint32_t overhead = UINT32_MAX;
+
+    for (run = 0U; run < DHRY_PROF_CALIBRATION_RUNS; run++)
+    {
+        begin = dhry_prof_now();
+        cycles = dhry_prof_now() - begin;
+        if (cycles < overhead)
+        {
+            overhead = cycles;
+        }
+    }
+
+    memset(&dhry_prof, 0, sizeof(dhry_prof));
+    dhry_prof.overhead_cycles = overhead;
+}
+
+/*******************************************************************************
+* Function Name: dhry_prof_record
+********************************************************************************
+* Summary:
+* Adds one call to the histogram of a procedure.
+*
+* Parameters:
+*  id: Procedure
+*  cycles: Cycles from entry to exit, including the profiler overhead
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void dhry_prof_record(dhry_prof_id_t id, uint32_t cycles)
+{
+    dhry_prof_hist_t *hist = &dhry_prof.hist[id];
+    uint32_t bucket = 0U;
+
+    cycles = (cycles > dhry_prof.overhead_cycles) ?
+             (cycles - dhry_prof.overhead_cycles) : 0U;
+
+    if (0U != cycles)
+    {
+        /* Number of significant bits of the cycle count */
+        bucket = 32U - __CLZ(cycles);
+        if (bucket >= DHRY_PROF_BUCKETS)
+        {
+            bucket = DHRY_PROF_BUCKETS - 1U;
+        }
+    }
+
+    if ((0U == hist->calls) || (cycles < hist->min_cycles))
+    {
+        hist->min_cycles = cycles;
+    }
+    if (cycles > hist->max_cycles)
+    {
+        hist->max_cycles = cycles;
+    }
+    hist->calls++;
+    hist->total_cycles += cycles;
+    hist->buckets[bucket]++;
+}
+
+#endif /* DHRY_PROFILE */
+
+/* [] END OF FILE */
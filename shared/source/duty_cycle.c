@@ -0,0 +1,278 @@
+/*******************************************************************************
+* File Name        : duty_cycle.c
+*
+* Description      : This file implements the duty-cycle workload. It owns the
+*                    low-power timer of the CPU while it is selected.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "lp_timer.h"
+#include "duty_cycle.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void duty_cycle_init(void);
+static void duty_cycle_run(void);
+static void duty_cycle_teardown(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+duty_cycle_config_t duty_cycle_config =
+{
+    DUTY_CYCLE_PERIOD_MS, DUTY_CYCLE_BURST_STEPS, DUTY_CYCLE_DEPTH,
+    DUTY_CYCLE_WORKLOAD
+};
+
+volatile uint32_t duty_cycle_bursts;
+volatile uint32_t duty_cycle_overruns;
+
+const workload_t duty_cycle_workload =
+{
+    "duty_cycle", duty_cycle_init, duty_cycle_run, duty_cycle_teardown
+};
+
+static duty_cycle_config_t config;
+static const workload_t *burst_workload;
+static cy_en_syspm_deep_sleep_mode_t saved_deep_sleep_mode;
+static uint32_t ticks_per_burst;
+static uint32_t next_burst_tick;
+static bool resuming;
+
+/*******************************************************************************
+* Function Name: enter_low_power
+********************************************************************************
+* Summary:
+* Puts the CPU in the configured state until the next interrupt. Before Deep
+* Sleep-OFF the state of the duty cycle goes to the backup registers, since
+* the wakeup is a warm boot; they are cleared again if the CPU returns.
+*
+*******************************************************************************/
+static void enter_low_power(void)
+{
+    volatile uint32_t *breg = DUTY_CYCLE_BREG;
+
+    if (DUTY_CYCLE_SLEEP == config.depth)
+    {
+        EVENT_TRACE(EVENT_TRACE_SLEEP_ENTER, 0U);
+        (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        EVENT_TRACE(EVENT_TRACE_SLEEP_EXIT, 0U);
+    }
+    else
+    {
+        if (DUTY_CYCLE_DEEP_SLEEP_OFF == config.depth)
+        {
+            breg[DUTY_CYCLE_WORD_PERIOD] = config.period_ms;
+            breg[DUTY_CYCLE_WORD_STEPS] = config.burst_steps;
+            breg[DUTY_CYCLE_WORD_BURSTS] = duty_cycle_bursts;
+            breg[DUTY_CYCLE_WORD_OVERRUNS] = duty_cycle_overruns;
+            breg[DUTY_CYCLE_WORD_HEADER] = (DUTY_CYCLE_MAGIC << 16) |
+                ((next_burst_tick - lp_timer_ticks()) & DUTY_CYCLE_TICKS_MASK);
+        }
+        EVENT_TRACE(EVENT_TRACE_DEEP_SLEEP_ENTER, 0U);
+        (void)Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        EVENT_TRACE(EVENT_TRACE_DEEP_SLEEP_EXIT, 0U);
+        breg[DUTY_CYCLE_WORD_HEADER] = 0U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: duty_cycle_init
+********************************************************************************
+* Summary:
+* Checks duty_cycle_config, prepares the burst workload and starts the timer.
+* Periods longer than LP_TIMER_MAX_PERIOD_MS are split into several timer
+* periods. The first burst runs at once, or after the timer ticks left when
+* the duty cycle resumes from Deep Sleep-OFF.
+*
+*******************************************************************************/
+static void duty_cycle_init(void)
+{
+    volatile uint32_t *breg = DUTY_CYCLE_BREG;
+    uint32_t tick_ms;
+
+    config = duty_cycle_config;
+    burst_workload = workload_find(config.workload);
+
+    if ((NULL == burst_workload) || (&duty_cycle_workload == burst_workload) ||
+        (0U == config.period_ms) || (0U == config.burst_steps))
+    {
+        handle_app_error();
+    }
+
+    ticks_per_burst = (config.period_ms + LP_TIMER_MAX_PERIOD_MS - 1U) /
+                      LP_TIMER_MAX_PERIOD_MS;
+    tick_ms = config.period_ms / ticks_per_burst;
+
+#if defined(COMPONENT_CM55)
+    /* Only the CM33 main() resumes from the warm boot */
+    if (DUTY_CYCLE_DEEP_SLEEP_OFF == config.depth)
+    {
+        handle_app_error();
+    }
+#endif
+    if ((DUTY_CYCLE_DEEP_SLEEP_OFF == config.depth) &&
+        (ticks_per_burst > DUTY_CYCLE_TICKS_MASK))
+    {
+        handle_app_error();
+    }
+
+    if (NULL != burst_workload->init)
+    {
+        burst_workload->init();
+    }
+
+    saved_deep_sleep_mode = Cy_SysPm_GetDeepSleepMode();
+    if (DUTY_CYCLE_DEEP_SLEEP_OFF == config.depth)
+    {
+        (void)Cy_SysPm_SetDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP_OFF);
+    }
+
+    if (resuming)
+    {
+        /* The wakeup ended one of the ticks left before the burst */
+        duty_cycle_bursts = breg[DUTY_CYCLE_WORD_BURSTS];
+        duty_cycle_overruns = breg[DUTY_CYCLE_WORD_OVERRUNS];
+        next_burst_tick = (breg[DUTY_CYCLE_WORD_HEADER] &
+                           DUTY_CYCLE_TICKS_MASK) - 1U;
+        breg[DUTY_CYCLE_WORD_HEADER] = 0U;
+        resuming = false;
+    }
+    else
+    {
+        duty_cycle_bursts = 0U;
+        duty_cycle_overruns = 0U;
+        next_burst_tick = 0U;
+    }
+    lp_timer_start(tick_ms);
+}
+
+/*******************************************************************************
+* Function Name: duty_cycle_run
+********************************************************************************
+* Summary:
+* Runs one period: the low-power state until the timer tick of the burst,
+* then a burst of the workload. A burst that ends after the tick of the next
+* one is an overrun; the next burst then starts at once and the period
+* restarts.
+*
+*******************************************************************************/
+static void duty_cycle_run(void)
+{
+    uint32_t step;
+
+    while ((int32_t)(lp_timer_ticks() - next_burst_tick) < 0)
+    {
+        enter_low_power();
+    }
+
+    for (step = 0U; step < config.burst_steps; step++)
+    {
+        burst_workload->run();
+    }
+    duty_cycle_bursts++;
+
+    next_burst_tick += ticks_per_burst;
+    if ((int32_t)(lp_timer_ticks() - next_burst_tick) >= 0)
+    {
+        duty_cycle_overruns++;
+        next_burst_tick = lp_timer_ticks();
+    }
+}
+
+/*******************************************************************************
+* Function Name: duty_cycle_teardown
+********************************************************************************
+* Summary:
+* Stops the timer and restores the Deep Sleep mode and the burst workload.
+*
+*******************************************************************************/
+static void duty_cycle_teardown(void)
+{
+    lp_timer_stop();
+
+    if (DUTY_CYCLE_DEEP_SLEEP_OFF == config.depth)
+    {
+        (void)Cy_SysPm_SetDeepSleepMode(saved_deep_sleep_mode);
+    }
+
+    if (NULL != burst_workload->teardown)
+    {
+        burst_workload->teardown();
+    }
+}
+
+/*******************************************************************************
+* Function Name: duty_cycle_resume
+********************************************************************************
+* Summary:
+* Resumes a Deep Sleep-OFF duty cycle after the warm boot of its wakeup. The
+* period, burst steps and counters come from the backup registers, and the
+* timer is started again with the ticks left before the next burst. The CM33
+* main() calls it after the workloads are registered and, when it returns
+* true, steps the workload without applying the power profile again. A reset
+* or a header without the magic is a cold boot.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true if the duty cycle was resumed and is the selected workload
+*
+*******************************************************************************/
+bool duty_cycle_resume(void)
+{
+    volatile uint32_t *breg = DUTY_CYCLE_BREG;
+
+    if (((breg[DUTY_CYCLE_WORD_HEADER] >> 16) != DUTY_CYCLE_MAGIC) ||
+        (0U != Cy_SysLib_GetResetReason()))
+    {
+        breg[DUTY_CYCLE_WORD_HEADER] = 0U;
+        return false;
+    }
+
+    duty_cycle_config.period_ms = breg[DUTY_CYCLE_WORD_PERIOD];
+    duty_cycle_config.burst_steps = breg[DUTY_CYCLE_WORD_STEPS];
+    duty_cycle_config.depth = DUTY_CYCLE_DEEP_SLEEP_OFF;
+    resuming = true;
+
+    return workload_select(duty_cycle_workload.name);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,200 @@
+/*******************************************************************************
+* File Name        : dvfs_governor.c
+*
+* Description      : This file implements the decision logic of the DVFS
+*                    governor: load thresholds with hysteresis, and the
+*                    choice of the slowest operating point that keeps the
+*                    projected load below the step-up threshold.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include "dvfs_governor.h"
+
+/*******************************************************************************
+* Function Name: dvfs_governor_init
+********************************************************************************
+* Summary:
+* Checks a configuration and starts the governor at a level. The capacities
+* must be non-zero and increase with the level, and the step-down threshold
+* must be below the step-up threshold so that the two cannot alternate.
+*
+* Parameters:
+*  gov: Governor
+*  config: Configuration, copied; the capacity table must stay valid
+*  level: Starting operating point
+*
+* Return:
+*  bool: false if the configuration or the level is invalid
+*
+*******************************************************************************/
+bool dvfs_governor_init(dvfs_governor_t *gov,
+                        const dvfs_governor_config_t *config, uint32_t level)
+{
+    uint32_t index;
+
+    if ((NULL == gov) || (NULL == config) || (NULL == config->capacity) ||
+        (0U == config->levels) ||
+        (config->levels > DVFS_GOVERNOR_MAX_LEVELS) ||
+        (level >= config->levels) || (0U == config->capacity[0]) ||
+        (config->down_permille >= config->up_permille) ||
+        (config->up_permille > DVFS_GOVERNOR_FULL_LOAD) ||
+        (0U == config->up_windows) || (0U == config->down_windows))
+    {
+        return false;
+    }
+
+    for (index = 1U; index < config->levels; index++)
+    {
+        if (config->capacity[index] <= config->capacity[index - 1U])
+        {
+            return false;
+        }
+    }
+
+    gov->config = *config;
+    gov->level = level;
+    gov->above = 0U;
+    gov->below = 0U;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: dvfs_governor_project
+********************************************************************************
+* Summary:
+* Returns the load that the work measured at the current level would give at
+* another level, in permille. Loads above a full window mean that the work
+* does not fit in the window at that level.
+*
+* Parameters:
+*  gov: Governor
+*  load_permille: Load measured at the current level
+*  level: Operating point to project to
+*
+* Return:
+*  uint32_t: Projected load in permille
+*
+*******************************************************************************/
+uint32_t dvfs_governor_project(const dvfs_governor_t *gov,
+                               uint32_t load_permille, uint32_t level)
+{
+    return (uint32_t)(((uint64_t)load_permille *
+                       gov->config.capacity[gov->level]) /
+                      gov->config.capacity[level]);
+}
+
+/*******************************************************************************
+* Function Name: dvfs_governor_update
+********************************************************************************
+* Summary:
+* Takes the load of one window and returns the operating point for the next.
+* After up_windows windows at or above up_permille the governor steps up to
+* the slowest level whose projected load is below up_permille; a saturated
+* window (full load) hides the real demand, so it goes to the fastest level.
+* After down_windows windows at or below down_permille it steps down to the
+* slowest level whose projected load is still below up_permille, and stays
+* if there is none. Loads between the thresholds reset both counts.
+*
+* Parameters:
+*  gov: Governor
+*  load_permille: Busy time of the window in permille, clamped to full load
+*
+* Return:
+*  uint32_t: Operating point for the next window
+*
+*******************************************************************************/
+uint32_t dvfs_governor_update(dvfs_governor_t *gov, uint32_t load_permille)
+{
+    const dvfs_governor_config_t *config = &gov->config;
+    uint32_t top = config->levels - 1U;
+    uint32_t level;
+
+    if (load_permille > DVFS_GOVERNOR_FULL_LOAD)
+    {
+        load_permille = DVFS_GOVERNOR_FULL_LOAD;
+    }
+
+    if (load_permille >= config->up_permille)
+    {
+        gov->below = 0U;
+        gov->above++;
+        if ((gov->above >= config->up_windows) && (gov->level < top))
+        {
+            level = top;
+            if (load_permille < DVFS_GOVERNOR_FULL_LOAD)
+            {
+                for (level = gov->level + 1U; level < top; level++)
+                {
+                    if (dvfs_governor_project(gov, load_permille, level) <
+                        config->up_permille)
+                    {
+                        break;
+                    }
+                }
+            }
+            gov->level = level;
+            gov->above = 0U;
+        }
+    }
+    else if (load_permille <= config->down_permille)
+    {
+        gov->above = 0U;
+        gov->below++;
+        if ((gov->below >= config->down_windows) && (gov->level > 0U))
+        {
+            for (level = 0U; level < gov->level; level++)
+            {
+                if (dvfs_governor_project(gov, load_permille, level) <
+                    config->up_permille)
+                {
+                    break;
+                }
+            }
+            gov->level = level;
+            gov->below = 0U;
+        }
+    }
+    else
+    {
+        gov->above = 0U;
+        gov->below = 0U;
+    }
+
+    return gov->level;
+}
+
+/* [] END OF FILE */
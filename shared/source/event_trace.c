@@ -0,0 +1,241 @@
+/*******************************************************************************
+* File Name        : event_trace.c
+*
+* Description      : This file provides the binary event trace of a core and
+*                    carries the newest CM33 records through Hibernate in the
+*                    backup registers.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "event_trace.h"
+
+#if defined(EVENT_TRACE_ENABLE)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BREG_HEADER_WORD            (0U)
+#define BREG_COUNT_WORD             (1U)
+#define BREG_BOOT_MASK              (0xFFFFUL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if defined(EVENT_TRACE_SECTION)
+event_trace_log_t event_trace_log CY_SECTION(EVENT_TRACE_SECTION);
+#else
+event_trace_log_t event_trace_log;
+#endif
+
+/*******************************************************************************
+* Function Name: breg_boot
+********************************************************************************
+* Summary:
+* Returns the boot count in the backup registers, or -1 when they hold no
+* trace header, as after a power-on reset.
+*
+*******************************************************************************/
+static int32_t breg_boot(void)
+{
+    uint32_t header = EVENT_TRACE_BREG[BREG_HEADER_WORD];
+
+    if ((header >> 16) != EVENT_TRACE_BREG_MAGIC)
+    {
+        return -1;
+    }
+
+    return (int32_t)(header & BREG_BOOT_MASK);
+}
+
+#if !defined(COMPONENT_CM55)
+/*******************************************************************************
+* Function Name: breg_restore
+********************************************************************************
+* Summary:
+* Appends the records saved before Hibernate to the log and clears them from
+* the backup registers.
+*
+* Return:
+*  uint32_t: Number of records taken back
+*
+*******************************************************************************/
+static uint32_t breg_restore(void)
+{
+    uint32_t words[EVENT_TRACE_RECORD_WORDS];
+    uint32_t count = EVENT_TRACE_BREG[BREG_COUNT_WORD];
+    event_trace_record_t *slot;
+    uint32_t record;
+    uint32_t word;
+    uint32_t head;
+
+    if (count > EVENT_TRACE_BREG_RECORDS)
+    {
+        count = EVENT_TRACE_BREG_RECORDS;
+    }
+
+    for (record = 0U; record < count; record++)
+    {
+        for (word = 0U; word < EVENT_TRACE_RECORD_WORDS; word++)
+        {
+            words[word] = EVENT_TRACE_BREG[EVENT_TRACE_BREG_HEADER +
+                              (record * EVENT_TRACE_RECORD_WORDS) + word];
+        }
+        head = event_trace_log.head;
+        slot = &event_trace_log.records[head & (EVENT_TRACE_RECORDS - 1U)];
+        (void)memcpy(slot, words, sizeof(words));
+        event_trace_log.head = head + 1U;
+    }
+    EVENT_TRACE_BREG[BREG_COUNT_WORD] = 0U;
+
+    return count;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: event_trace_init
+********************************************************************************
+* Summary:
+* Prepares the log of the calling core and logs the boot. A log whose memory
+* was retained through a reset of the core keeps its records. The CM33 counts
+* the boot in the backup registers and takes back the records saved before
+* Hibernate; the CM55 takes the boot count of the CM33, so it must start
+* after the CM33 called this function.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_trace_init(void)
+{
+    int32_t boot = breg_boot();
+    uint32_t restored = 0U;
+
+    if (EVENT_TRACE_MAGIC != event_trace_log.magic)
+    {
+        (void)memset(&event_trace_log, 0, sizeof(event_trace_log));
+        event_trace_log.magic = EVENT_TRACE_MAGIC;
+        event_trace_log.core = EVENT_TRACE_CORE;
+    }
+
+#if defined(COMPONENT_CM55)
+    event_trace_log.boot = (boot < 0) ? 0U : (uint32_t)boot;
+#else
+    if (boot < 0)
+    {
+        event_trace_log.boot = 0U;
+    }
+    else
+    {
+        event_trace_log.boot = ((uint32_t)boot + 1U) & BREG_BOOT_MASK;
+        restored = breg_restore();
+    }
+    EVENT_TRACE_BREG[BREG_HEADER_WORD] =
+        ((uint32_t)EVENT_TRACE_BREG_MAGIC << 16) | event_trace_log.boot;
+#endif
+
+    event_trace_write(EVENT_TRACE_BOOT, restored);
+}
+
+/*******************************************************************************
+* Function Name: event_trace_hibernate
+********************************************************************************
+* Summary:
+* Logs the Hibernate entry and copies the newest records of the CM33 log,
+* oldest first, to the backup registers, which keep their content through
+* Hibernate. Call it on the CM33 just before the system enters Hibernate.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_trace_hibernate(void)
+{
+    uint32_t words[EVENT_TRACE_RECORD_WORDS];
+    uint32_t head = event_trace_log.head + 1U;
+    uint32_t count = (head < EVENT_TRACE_BREG_RECORDS) ?
+                     head : EVENT_TRACE_BREG_RECORDS;
+    uint32_t record;
+    uint32_t word;
+
+    event_trace_write(EVENT_TRACE_HIBERNATE, count);
+
+    for (record = 0U; record < count; record++)
+    {
+        (void)memcpy(words, &event_trace_log.records[
+                         (head - count + record) & (EVENT_TRACE_RECORDS - 1U)],
+                     sizeof(words));
+        for (word = 0U; word < EVENT_TRACE_RECORD_WORDS; word++)
+        {
+            EVENT_TRACE_BREG[EVENT_TRACE_BREG_HEADER +
+                (record * EVENT_TRACE_RECORD_WORDS) + word] = words[word];
+        }
+    }
+    EVENT_TRACE_BREG[BREG_COUNT_WORD] = count;
+}
+
+#else
+
+/*******************************************************************************
+* Function Name: event_trace_init
+********************************************************************************
+* Summary:
+* Does nothing without EVENT_TRACE_ENABLE.
+*
+*******************************************************************************/
+void event_trace_init(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: event_trace_hibernate
+********************************************************************************
+* Summary:
+* Does nothing without EVENT_TRACE_ENABLE.
+*
+*******************************************************************************/
+void event_trace_hibernate(void)
+{
+}
+
+#endif /* EVENT_TRACE_ENABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* File Name        : gating.c
+*
+* Description      : This file provides the clock and peripheral gating
+*                    manifests of the power profiles, the gating of the
+*                    resources that each core owns, and the audit of the
+*                    resources that are on.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "gating.h"
+#include "pd_manager.h"
+#include "cy_device.h"
+#include "ppu_v1.h"
+#include "cy_syspm_ppu.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Resources gated by the core this file is built for */
+#if defined(COMPONENT_CM55)
+#define OWNED_HF                    (GATING_CM55_HF)
+#define OWNED_PERI_SLAVES           (GATING_CM55_PERI_SLAVES)
+#else
+#define OWNED_HF                    (GATING_CM33_HF)
+#define OWNED_PERI_SLAVES           (0U)
+#endif
+
+/* Peripheral group in the PDL group number format: instance in bits 8-15 */
+#define PERI_GROUP_ID               ((GATING_PERI_NUM << 8U) | \
+                                     GATING_PERI_GROUP_NUM)
+
+/* CLK_HF clocks that are always on; the manifests cannot gate them */
+#define ALWAYS_ON_HF                (GATING_HF(CY_CFG_SYSCLK_CLKHF0))
+
+#define ALL_PERI_SLAVES             (GATING_CM55_PERI_SLAVES)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const gating_manifest_t gating_manifest_boot =
+{
+    .hf_on = ALWAYS_ON_HF | GATING_CM33_HF | GATING_CM55_HF,
+    .peri_slaves_on = ALL_PERI_SLAVES
+};
+
+const gating_manifest_t gating_manifest_pd1_on =
+{
+    .hf_on = ALWAYS_ON_HF | GATING_CM33_HF,
+    .peri_slaves_on = 0U
+};
+
+const gating_manifest_t gating_manifest_pd1_off =
+{
+    .hf_on = ALWAYS_ON_HF,
+    .peri_slaves_on = 0U
+};
+
+gating_audit_t gating_audit;
+
+/* PPU domains of the audit, in the order of the GATING_PPU_x bits */
+static struct ppu_v1_reg *const audit_ppus[] =
+{
+    (struct ppu_v1_reg *)CY_PPU_PD1_BASE,
+    (struct ppu_v1_reg *)CY_PPU_SOCMEM_BASE,
+    (struct ppu_v1_reg *)CY_PPU_APPCPUSS_BASE,
+    (struct ppu_v1_reg *)CY_PPU_APPCPU_BASE
+};
+
+#define AUDIT_PPU_COUNT     (sizeof(audit_ppus) / sizeof(audit_ppus[0]))
+
+/*******************************************************************************
+* Function Name: peri_slave_enabled
+********************************************************************************
+* Summary:
+* Returns true if the clock of a slave of the gated peripheral group is on.
+*
+*******************************************************************************/
+static bool peri_slave_enabled(uint32_t slave)
+{
+    return Cy_SysClk_IsPeriGroupSlaveCtlSet(PERI_GROUP_ID,
+                                            CY_SYSCLK_PERI_GROUP_SL_CTL,
+                                            slave);
+}
+
+/*******************************************************************************
+* Function Name: gating_apply
+********************************************************************************
+* Summary:
+* Brings the resources owned by the calling core to the state of a manifest:
+* the peripheral slaves that the manifest gates are deinitialized, and the
+* CLK_HF clocks are enabled or disabled. Only resources whose state differs
+* are changed. Gated peripheral slaves are not initialized again; that is left
+* to the driver of the peripheral.
+*
+* Parameters:
+*  manifest: Resources that stay on
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gating_apply(const gating_manifest_t *manifest)
+{
+    uint32_t index;
+    bool on;
+
+    for (index = 0U; index < GATING_PERI_SLAVE_COUNT; index++)
+    {
+        if ((0U != (OWNED_PERI_SLAVES & GATING_PERI_SLAVE(index))) &&
+            (0U == (manifest->peri_slaves_on & GATING_PERI_SLAVE(index))) &&
+            peri_slave_enabled(index))
+        {
+            Cy_SysClk_PeriGroupSlaveDeinit(GATING_PERI_NUM,
+                                           GATING_PERI_GROUP_NUM, index);
+        }
+    }
+
+    for (index = 0U; index < SRSS_NUM_HFROOT; index++)
+    {
+        if (0U == (OWNED_HF & GATING_HF(index)))
+        {
+            continue;
+        }
+
+        on = (0U != (manifest->hf_on & GATING_HF(index)));
+        if (on == Cy_SysClk_ClkHfIsEnabled(index))
+        {
+            continue;
+        }
+
+        if (on)
+        {
+            (void)Cy_SysClk_ClkHfEnable(index);
+        }
+        else
+        {
+            (void)Cy_SysClk_ClkHfDisable(index);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: gating_audit_read
+********************************************************************************
+* Summary:
+* Reads back which CLK_HF clocks, PLL paths, peripheral slaves and PPU
+* domains are on, and which of the resources gated by a manifest are still
+* on. The peripheral group is in PD1: when PD1 is off its registers are not
+* read and its slaves are reported off.
+*
+* Parameters:
+*  manifest: Manifest of the applied profile
+*  audit: Filled with the state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gating_audit_read(const gating_manifest_t *manifest,
+                       gating_audit_t *audit)
+{
+    uint32_t index;
+
+    audit->hf_on = 0U;
+    for (index = 0U; index < SRSS_NUM_HFROOT; index++)
+    {
+        if (Cy_SysClk_ClkHfIsEnabled(index))
+        {
+            audit->hf_on |= GATING_HF(index);
+        }
+    }
+
+    audit->pll_on = 0U;
+    for (index = 0U; index < SRSS_NUM_CLKPATH; index++)
+    {
+        if (Cy_SysClk_PllIsEnabled(index))
+        {
+            audit->pll_on |= (1UL << index);
+        }
+    }
+
+    audit->peri_slaves_on = 0U;
+    if (0U != (pd_manager_state() & PD_MANAGER_DOMAIN(PD_DOMAIN_PD1)))
+    {
+        for (index = 0U; index < GATING_PERI_SLAVE_COUNT; index++)
+        {
+            if (peri_slave_enabled(index))
+            {
+                audit->peri_slaves_on |= GATING_PERI_SLAVE(index);
+            }
+        }
+    }
+
+    audit->ppu_on = 0U;
+    for (index = 0U; index < AUDIT_PPU_COUNT; index++)
+    {
+        if ((uint32_t)PPU_V1_MODE_OFF !=
+            cy_pd_ppu_get_power_mode(audit_ppus[index]))
+        {
+            audit->ppu_on |= (1UL << index);
+        }
+    }
+
+    audit->hf_leaks = audit->hf_on & (GATING_CM33_HF | GATING_CM55_HF) &
+                      ~manifest->hf_on;
+    audit->peri_slave_leaks = audit->peri_slaves_on & ALL_PERI_SLAVES &
+                              ~manifest->peri_slaves_on;
+}
+
+/*******************************************************************************
+* Function Name: gating_audit_format
+********************************************************************************
+* Summary:
+* Formats an audit as one line of hexadecimal masks, for example
+* "hf 0007 pll 2 peri 0 ppu f leak 0000 0": CLK_HF clocks, PLL paths,
+* peripheral slaves and PPU domains that are on, then the CLK_HF clocks and
+* peripheral slaves that are on although the manifest gates them.
+*
+* Parameters:
+*  audit: Audit to format
+*  text: Buffer of GATING_AUDIT_TEXT_LEN characters
+*  size: Size of the buffer
+*
+* Return:
+*  uint32_t: Length of the text in the buffer, without the terminator; a
+*            text cut to fit the buffer counts only what was written
+*
+*******************************************************************************/
+uint32_t gating_audit_format(const gating_audit_t *audit, char *text,
+                             uint32_t size)
+{
+    int length;
+
+    length = snprintf(text, size, "hf %04lx pll %lx peri %lx ppu %lx "
+                      "leak %04lx %lx", (unsigned long)audit->hf_on,
+                      (unsigned long)audit->pll_on,
+                      (unsigned long)audit->peri_slaves_on,
+                      (unsigned long)audit->ppu_on,
+                      (unsigned long)audit->hf_leaks,
+                      (unsigned long)audit->peri_slave_leaks);
+
+    if ((length < 0) || (0U == size))
+    {
+        return 0U;
+    }
+
+    return ((uint32_t)length < size) ? (uint32_t)length : (size - 1U);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,228 @@
+/*******************************************************************************
+* File Name        : lp_timer.c
+*
+* Description      : This file implements the low-power timer on counter 0 of
+*                    the MCWDT reserved for the calling CPU (MCWDT 0 for the
+*                    CM33, MCWDT 1 for the CM55).
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "specs.h"
+#include "lp_timer.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(COMPONENT_CM55)
+#define LP_TIMER_HW                 (MCWDT_STRUCT1)
+#define LP_TIMER_IRQ                (srss_interrupt_mcwdt_1_IRQn)
+#else
+#define LP_TIMER_HW                 (MCWDT_STRUCT0)
+#define LP_TIMER_IRQ                (srss_interrupt_mcwdt_0_IRQn)
+#endif
+
+#define LP_TIMER_IRQ_PRIORITY       (3U)
+
+/* Counter updates take effect after up to three CLK_LF cycles */
+#define LP_TIMER_WAIT_US            (93U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static volatile uint32_t tick_count;
+static volatile uint32_t isr_cycles;
+
+/*******************************************************************************
+* Function Name: lp_timer_isr
+********************************************************************************
+* Summary:
+* Counts one timer period and stamps the entry with the cycle counter.
+*
+*******************************************************************************/
+static void lp_timer_isr(void)
+{
+    isr_cycles = cycle_counter_read();
+    Cy_MCWDT_ClearInterrupt(LP_TIMER_HW, CY_MCWDT_CTR0);
+    tick_count++;
+}
+
+/*******************************************************************************
+* Function Name: lp_timer_start
+********************************************************************************
+* Summary:
+* Starts a periodic interrupt and clears the tick count.
+*
+* Parameters:
+*  period_ms: Period in milliseconds, 1 to LP_TIMER_MAX_PERIOD_MS
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void lp_timer_start(uint32_t period_ms)
+{
+    const cy_stc_sysint_t irq_cfg =
+    {
+        .intrSrc = LP_TIMER_IRQ,
+        .intrPriority = LP_TIMER_IRQ_PRIORITY
+    };
+    cy_stc_mcwdt_config_t mcwdt_cfg =
+    {
+        .c0Match = 0U,
+        .c0Mode = CY_MCWDT_MODE_INT,
+        .c0ClearOnMatch = true,
+    };
+    uint32_t lf_ticks = (period_ms * LP_TIMER_CLK_LF_HZ) / 1000U;
+
+    if ((0U == period_ms) || (period_ms > LP_TIMER_MAX_PERIOD_MS) ||
+        (0U == lf_ticks))
+    {
+        handle_app_error();
+    }
+
+    /* The counter is cleared on the cycle after a match */
+    mcwdt_cfg.c0Match = (uint16_t)(lf_ticks - 1U);
+
+    Cy_MCWDT_Disable(LP_TIMER_HW, CY_MCWDT_CTR0, LP_TIMER_WAIT_US);
+    if (CY_MCWDT_SUCCESS != Cy_MCWDT_Init(LP_TIMER_HW, &mcwdt_cfg))
+    {
+        handle_app_error();
+    }
+
+    if (CY_SYSINT_SUCCESS != Cy_SysInt_Init(&irq_cfg, lp_timer_isr))
+    {
+        handle_app_error();
+    }
+    NVIC_ClearPendingIRQ(irq_cfg.intrSrc);
+    NVIC_EnableIRQ(irq_cfg.intrSrc);
+
+    tick_count = 0U;
+    Cy_MCWDT_ClearInterrupt(LP_TIMER_HW, CY_MCWDT_CTR0);
+    Cy_MCWDT_SetInterruptMask(LP_TIMER_HW, CY_MCWDT_CTR0);
+    Cy_MCWDT_Enable(LP_TIMER_HW, CY_MCWDT_CTR0, LP_TIMER_WAIT_US);
+}
+
+/*******************************************************************************
+* Function Name: lp_timer_stop
+********************************************************************************
+* Summary:
+* Stops the timer and its interrupt.
+*
+*******************************************************************************/
+void lp_timer_stop(void)
+{
+    Cy_MCWDT_Disable(LP_TIMER_HW, CY_MCWDT_CTR0, LP_TIMER_WAIT_US);
+    Cy_MCWDT_SetInterruptMask(LP_TIMER_HW, 0U);
+    NVIC_DisableIRQ(LP_TIMER_IRQ);
+}
+
+/*******************************************************************************
+* Function Name: lp_timer_ticks
+********************************************************************************
+* Summary:
+* Returns the number of periods elapsed since lp_timer_start().
+*
+*******************************************************************************/
+uint32_t lp_timer_ticks(void)
+{
+    return tick_count;
+}
+
+/*******************************************************************************
+* Function Name: lp_timer_isr_cycles
+********************************************************************************
+* Summary:
+* Returns the cycle counter value at the entry of the last timer interrupt.
+* Wake-up benchmarks compare it with the value after the CPU resumes.
+*
+*******************************************************************************/
+uint32_t lp_timer_isr_cycles(void)
+{
+    return isr_cycles;
+}
+
+/*******************************************************************************
+* Function Name: lp_timer_wait_ms
+********************************************************************************
+* Summary:
+* Calls step() repeatedly until the duration has elapsed. The step must return
+* at least once per timer period, for example by entering a CPU low-power mode
+* that the timer interrupt wakes up. Without a step the CPU sleeps.
+*
+* Parameters:
+*  duration_ms: Time to wait; periods longer than LP_TIMER_MAX_PERIOD_MS are
+*               counted in several timer periods
+*  step: Function run while waiting, or NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void lp_timer_wait_ms(uint32_t duration_ms, void (*step)(void))
+{
+    uint32_t periods = 1U;
+    uint32_t period_ms = duration_ms;
+
+    if (0U == duration_ms)
+    {
+        return;
+    }
+
+    if (duration_ms > LP_TIMER_MAX_PERIOD_MS)
+    {
+        periods = (duration_ms + LP_TIMER_MAX_PERIOD_MS - 1U) /
+                  LP_TIMER_MAX_PERIOD_MS;
+        period_ms = (duration_ms + periods - 1U) / periods;
+    }
+
+    lp_timer_start(period_ms);
+    while (lp_timer_ticks() < periods)
+    {
+        if (NULL != step)
+        {
+            step();
+        }
+        else
+        {
+            Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        }
+    }
+    lp_timer_stop();
+}
+
+/* [] END OF FILE */
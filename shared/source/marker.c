@@ -0,0 +1,127 @@
+/*******************************************************************************
+* File Name        : marker.c
+*
+* Description      : This file implements the phase markers. A phase is a
+*                    high level on the phase pin, preceded by its code as a
+*                    number of pulses on the code pin. All functions do
+*                    nothing unless MARKER_ENABLE is defined.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "marker.h"
+
+/*******************************************************************************
+* Function Name: marker_init
+********************************************************************************
+* Summary:
+* Configures the marker pins of both CPUs as strong drive outputs. The CM33
+* calls it before it starts the CM55. The phase and code pins start low and
+* the iteration pins high.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void marker_init(void)
+{
+#if defined(MARKER_ENABLE)
+    Cy_GPIO_Pin_FastInit(MARKER_PORT, MARKER_PIN_ITERATION_CM33,
+                         CY_GPIO_DM_STRONG_IN_OFF, 1U, HSIOM_SEL_GPIO);
+    Cy_GPIO_Pin_FastInit(MARKER_PORT, MARKER_PIN_ITERATION_CM55,
+                         CY_GPIO_DM_STRONG_IN_OFF, 1U, HSIOM_SEL_GPIO);
+    Cy_GPIO_Pin_FastInit(MARKER_PORT, MARKER_PIN_PHASE,
+                         CY_GPIO_DM_STRONG_IN_OFF, 0U, HSIOM_SEL_GPIO);
+    Cy_GPIO_Pin_FastInit(MARKER_PORT, MARKER_PIN_CODE,
+                         CY_GPIO_DM_STRONG_IN_OFF, 0U, HSIOM_SEL_GPIO);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: marker_phase
+********************************************************************************
+* Summary:
+* Ends the current phase and starts the next one. The code pulses are sent
+* while the phase pin is low, so they fall between the two phase windows.
+*
+* Parameters:
+*  code: Phase code, 1 to MARKER_CODE_MAX
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void marker_phase(uint32_t code)
+{
+#if defined(MARKER_ENABLE)
+    uint32_t pulse;
+
+    if ((0U == code) || (code > MARKER_CODE_MAX))
+    {
+        handle_app_error();
+    }
+
+    Cy_GPIO_Clr(MARKER_PORT, MARKER_PIN_PHASE);
+    for (pulse = 0U; pulse < code; pulse++)
+    {
+        Cy_SysLib_DelayUs(MARKER_PULSE_US);
+        Cy_GPIO_Set(MARKER_PORT, MARKER_PIN_CODE);
+        Cy_SysLib_DelayUs(MARKER_PULSE_US);
+        Cy_GPIO_Clr(MARKER_PORT, MARKER_PIN_CODE);
+    }
+    Cy_SysLib_DelayUs(MARKER_PULSE_US);
+    Cy_GPIO_Set(MARKER_PORT, MARKER_PIN_PHASE);
+#else
+    CY_UNUSED_PARAMETER(code);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: marker_phase_end
+********************************************************************************
+* Summary:
+* Ends the current phase without starting another one.
+*
+*******************************************************************************/
+void marker_phase_end(void)
+{
+#if defined(MARKER_ENABLE)
+    Cy_GPIO_Clr(MARKER_PORT, MARKER_PIN_PHASE);
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* File Name        : pd_manager.c
+*
+* Description      : This file provides the power-domain manager: the
+*                    dependency graph of the PD1 power domains and the
+*                    ordered PPU and PDCM changes between two sets of
+*                    domains.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include "cybsp.h"
+#include "cy_device.h"
+#include "ppu_v1.h"
+#include "cy_syspm_ppu.h"
+#include "cy_syspm_pdcm.h"
+#include "cycle_counter.h"
+#include "pd_manager.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NO_PARENT                   (PD_DOMAIN_COUNT)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+typedef struct
+{
+    struct ppu_v1_reg *ppu;
+    pd_domain_t parent;             /* Must be on while the domain is on     */
+    bool held_by_syscpu;            /* PDCM keeps it on while SYSCPU is on   */
+} pd_domain_info_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* PD1 holds SOCMEM and the application CPU subsystem, which holds the CM55.
+ * After reset the PDCM keeps APPCPUSS on while the SYSCPU (CM33) is on; the
+ * dependency is cleared for the power-down of APPCPUSS and set again after
+ * its power-up. */
+static const pd_domain_info_t domains[PD_DOMAIN_COUNT] =
+{
+    [PD_DOMAIN_PD1]      = { (struct ppu_v1_reg *)CY_PPU_PD1_BASE,
+                             NO_PARENT, false },
+    [PD_DOMAIN_SOCMEM]   = { (struct ppu_v1_reg *)CY_PPU_SOCMEM_BASE,
+                             PD_DOMAIN_PD1, false },
+    [PD_DOMAIN_APPCPUSS] = { (struct ppu_v1_reg *)CY_PPU_APPCPUSS_BASE,
+                             PD_DOMAIN_PD1, true },
+    [PD_DOMAIN_APPCPU]   = { (struct ppu_v1_reg *)CY_PPU_APPCPU_BASE,
+                             PD_DOMAIN_APPCPUSS, false }
+};
+
+/*******************************************************************************
+* Function Name: domain_on
+********************************************************************************
+* Summary:
+* Returns true if the PPU of a domain reports ON.
+*
+*******************************************************************************/
+static bool domain_on(pd_domain_t domain)
+{
+    return ((uint32_t)PPU_V1_MODE_ON ==
+            cy_pd_ppu_get_power_mode(domains[domain].ppu));
+}
+
+/*******************************************************************************
+* Function Name: power_down
+********************************************************************************
+* Summary:
+* Requests OFF for a domain. The domain of the calling CPU turns off once the
+* CPU waits for interrupts, so the request is not waited for.
+*
+*******************************************************************************/
+static void power_down(pd_domain_t domain)
+{
+    if (domains[domain].held_by_syscpu)
+    {
+        (void)cy_pd_pdcm_clear_dependency(CY_PD_PDCM_APPCPUSS,
+                                          CY_PD_PDCM_SYSCPU);
+    }
+
+    (void)cy_pd_ppu_set_power_mode(domains[domain].ppu,
+                                   (uint32_t)PPU_V1_MODE_OFF);
+}
+
+/*******************************************************************************
+* Function Name: power_up
+********************************************************************************
+* Summary:
+* Turns a domain on and waits until its PPU reports ON, so that the domains
+* that depend on it can follow.
+*
+*******************************************************************************/
+static bool power_up(pd_domain_t domain)
+{
+    uint32_t waited_us = 0U;
+
+    (void)cy_pd_ppu_set_power_mode(domains[domain].ppu,
+                                   (uint32_t)PPU_V1_MODE_ON);
+    while (!domain_on(domain))
+    {
+        if (waited_us >= PD_MANAGER_TIMEOUT_US)
+        {
+            return false;
+        }
+        Cy_SysLib_DelayUs(1U);
+        waited_us++;
+    }
+
+    if (domains[domain].held_by_syscpu)
+    {
+        (void)cy_pd_pdcm_set_dependency(CY_PD_PDCM_APPCPUSS,
+                                        CY_PD_PDCM_SYSCPU);
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_state
+********************************************************************************
+* Summary:
+* Returns the managed domains whose PPU reports ON.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: PD_MANAGER_DOMAIN() of each domain that is on
+*
+*******************************************************************************/
+uint32_t pd_manager_state(void)
+{
+    uint32_t state = 0U;
+    uint32_t index;
+
+    for (index = 0U; index < (uint32_t)PD_DOMAIN_COUNT; index++)
+    {
+        if (domain_on((pd_domain_t)index))
+        {
+            state |= PD_MANAGER_DOMAIN(index);
+        }
+    }
+
+    return state;
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_closure
+********************************************************************************
+* Summary:
+* Adds to a set of domains every domain they depend on.
+*
+* Parameters:
+*  domains_on: PD_MANAGER_DOMAIN() of the domains to keep on
+*
+* Return:
+*  uint32_t: The domains and the domains they depend on
+*
+*******************************************************************************/
+uint32_t pd_manager_closure(uint32_t domains_on)
+{
+    uint32_t index;
+
+    /* Children come after their parents, so one pass from the end adds the
+     * whole chain of parents */
+    for (index = (uint32_t)PD_DOMAIN_COUNT; index-- > 0U; )
+    {
+        if ((0U != (domains_on & PD_MANAGER_DOMAIN(index))) &&
+            (NO_PARENT != domains[index].parent))
+        {
+            domains_on |= PD_MANAGER_DOMAIN(domains[index].parent);
+        }
+    }
+
+    return domains_on & PD_MANAGER_ALL;
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_set
+********************************************************************************
+* Summary:
+* Brings the managed domains to a set, extended by the domains it depends on.
+* Only the domains whose state differs change. Domains are powered down from
+* the leaves of the dependency graph towards PD1, clearing the PDCM dependency
+* that holds APPCPUSS on first, and powered up from PD1 towards the leaves,
+* waiting for each to report ON and setting the PDCM dependency again. The
+* cycle counter must be running on the calling CPU for the time to be valid.
+*
+* Parameters:
+*  domains_on: PD_MANAGER_DOMAIN() of the domains to be on; the others
+*              turn off
+*  result: Filled with the changes and their time, or NULL
+*
+* Return:
+*  bool: false if a domain did not reach ON within PD_MANAGER_TIMEOUT_US
+*
+*******************************************************************************/
+bool pd_manager_set(uint32_t domains_on, pd_manager_result_t *result)
+{
+    pd_manager_result_t changes = { 0U, 0U, 0U, 0U };
+    uint32_t begin = cycle_counter_read();
+    uint32_t target = pd_manager_closure(domains_on);
+    uint32_t state = pd_manager_state();
+    uint32_t index;
+    bool success = true;
+
+    for (index = (uint32_t)PD_DOMAIN_COUNT; index-- > 0U; )
+    {
+        if ((0U != (state & PD_MANAGER_DOMAIN(index))) &&
+            (0U == (target & PD_MANAGER_DOMAIN(index))))
+        {
+            power_down((pd_domain_t)index);
+            changes.powered_down |= PD_MANAGER_DOMAIN(index);
+            changes.transitions++;
+        }
+    }
+
+    for (index = 0U; success && (index < (uint32_t)PD_DOMAIN_COUNT); index++)
+    {
+        if ((0U == (state & PD_MANAGER_DOMAIN(index))) &&
+            (0U != (target & PD_MANAGER_DOMAIN(index))))
+        {
+            success = power_up((pd_domain_t)index);
+            changes.powered_up |= PD_MANAGER_DOMAIN(index);
+            changes.transitions++;
+        }
+    }
+
+    changes.cycles = cycle_counter_read() - begin;
+    if (0U != changes.transitions)
+    {
+        EVENT_TRACE(EVENT_TRACE_DOMAINS, pd_manager_state());
+    }
+    if (NULL != result)
+    {
+        *result = changes;
+    }
+
+    return success;
+}
+
+/* [] END OF FILE */
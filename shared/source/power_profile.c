@@ -0,0 +1,363 @@
+/*******************************************************************************
+* File Name        : power_profile.c
+*
+* Description      : This file holds the power profile of every datasheet
+*                    SPEC ID and passes the selected profile from the CM33 to
+*                    the CM55 through an IPC mailbox.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "power_profile.h"
+#include "workload.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* DPLL-LP frequency of SIDH00A and SIDH01A, which run HF0 undivided */
+#define DPLL_FREQ_HP1_HZ            (200000000U)
+
+#define DIV_1                       (CY_SYSCLK_CLKHF_NO_DIVIDE)
+#define DIV_2                       (CY_SYSCLK_CLKHF_DIVIDE_BY_2)
+
+/* Columns: system mode, DPLL-LP Hz, HF0 and HF1 dividers */
+#define HP              POWER_SYSTEM_HP, POWER_DPLL_FREQ_HP_HZ, DIV_2, DIV_1
+#define HP1             POWER_SYSTEM_HP, DPLL_FREQ_HP1_HZ, DIV_1, DIV_1
+#define LP70            POWER_SYSTEM_LP, 70000000U, DIV_1, DIV_1
+#define LP140           POWER_SYSTEM_LP, 140000000U, DIV_2, DIV_1
+#define ULP             POWER_SYSTEM_ULP, 0U, DIV_1, DIV_1
+
+/* Gating manifests (gating.h) */
+#define PD1_ON_GATING   (&gating_manifest_pd1_on)
+#define PD1_OFF_GATING  (&gating_manifest_pd1_off)
+
+/* SRAM retention (sram_retention.h) */
+#define ALL_SRAM        (NULL)
+#define DSA_SRAM        (&sram_retention_siddsa)
+
+/* Columns: PD1 off, CM55 off, Deep Sleep-OFF, CM33 and CM55 workloads,
+ * gating manifest, SRAM retention */
+#define PD1_OFF_SLEEP   true, false, false, "sleep", "deep_sleep", \
+                        PD1_OFF_GATING, ALL_SRAM
+#define PD1_OFF_DHRY    true, false, false, "dhrystone", "deep_sleep", \
+                        PD1_OFF_GATING, ALL_SRAM
+#define CM55_OFF_SLEEP  false, true, false, "sleep", "deep_sleep", \
+                        PD1_ON_GATING, ALL_SRAM
+#define BOTH_SLEEP      false, false, false, "sleep", "sleep", \
+                        PD1_ON_GATING, ALL_SRAM
+#define CM55_DHRY       false, false, false, "sleep", "dhrystone", \
+                        PD1_ON_GATING, ALL_SRAM
+#define BOTH_DHRY       false, false, false, "dhrystone", "dhrystone", \
+                        PD1_ON_GATING, ALL_SRAM
+#define DSO_DEEP_SLEEP  true, false, true, "deep_sleep", "deep_sleep", \
+                        PD1_OFF_GATING, ALL_SRAM
+#define DSA_DEEP_SLEEP  true, false, false, "deep_sleep", "deep_sleep", \
+                        PD1_OFF_GATING, DSA_SRAM
+#define HIBERNATE       false, false, false, "hibernate", "while_loop", \
+                        PD1_ON_GATING, ALL_SRAM
+
+/* Profile of the CUSTOM SPEC ID, taken from the options in specs.h */
+#if defined(SYSTEM_ULP)
+#define CUSTOM_SYSTEM   ULP
+#elif defined(SYSTEM_LP) && defined(SET_HF_DIV_ONE)
+#define CUSTOM_SYSTEM   POWER_SYSTEM_LP, DPLL_FREQ_LP_HZ, DIV_1, DIV_1
+#elif defined(SYSTEM_LP)
+#define CUSTOM_SYSTEM   POWER_SYSTEM_LP, DPLL_FREQ_LP_HZ, DIV_2, DIV_1
+#else
+#define CUSTOM_SYSTEM   HP
+#endif
+
+#if defined(DISABLE_PD1)
+#define CUSTOM_DISABLE_PD1          true
+#define CUSTOM_GATING               PD1_OFF_GATING
+#else
+#define CUSTOM_DISABLE_PD1          false
+#define CUSTOM_GATING               PD1_ON_GATING
+#endif
+
+#if defined(DISABLE_CM55)
+#define CUSTOM_DISABLE_CM55         true
+#else
+#define CUSTOM_DISABLE_CM55         false
+#endif
+
+#if defined(DEEPSLEEP_OFF)
+#define CUSTOM_DEEPSLEEP_OFF        true
+#else
+#define CUSTOM_DEEPSLEEP_OFF        false
+#endif
+
+#if defined(SRAM_PARTIAL_RETENTION)
+#define CUSTOM_SRAM_RETENTION       DSA_SRAM
+#else
+#define CUSTOM_SRAM_RETENTION       ALL_SRAM
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const power_profile_t power_profiles[] =
+{
+    { SIDH00A, "SIDH00A", HP1,   PD1_OFF_SLEEP  },
+    { SIDH01A, "SIDH01A", HP1,   PD1_OFF_DHRY   },
+    { SIDH10A, "SIDH10A", HP,    CM55_OFF_SLEEP },
+    { SIDH12A, "SIDH12A", HP,    BOTH_SLEEP     },
+    { SIDH14A, "SIDH14A", HP,    CM55_DHRY      },
+    { SIDH20A, "SIDH20A", HP,    BOTH_DHRY      },
+    { SIDL00B, "SIDL00B", LP70,  PD1_OFF_SLEEP  },
+    { SIDL01B, "SIDL01B", LP70,  PD1_OFF_DHRY   },
+    { SIDL10B, "SIDL10B", LP140, CM55_OFF_SLEEP },
+    { SIDL12B, "SIDL12B", LP140, BOTH_SLEEP     },
+    { SIDL14B, "SIDL14B", LP140, CM55_DHRY      },
+    { SIDL20B, "SIDL20B", LP140, BOTH_DHRY      },
+    { SIDU00C, "SIDU00C", ULP,   PD1_OFF_SLEEP  },
+    { SIDU01C, "SIDU01C", ULP,   PD1_OFF_DHRY   },
+    { SIDU10C, "SIDU10C", ULP,   CM55_OFF_SLEEP },
+    { SIDU12C, "SIDU12C", ULP,   BOTH_SLEEP     },
+    { SIDU14C, "SIDU14C", ULP,   CM55_DHRY      },
+    { SIDU20C, "SIDU20C", ULP,   BOTH_DHRY      },
+    { SIDDSO,  "SIDDSO",  HP,    DSO_DEEP_SLEEP },
+    { SIDHIBA, "SIDHIBA", HP,    HIBERNATE      },
+    { SIDDSA,  "SIDDSA",  HP,    DSA_DEEP_SLEEP },
+#if (SPEC_ID == CUSTOM)
+    { CUSTOM,  "CUSTOM",  CUSTOM_SYSTEM, CUSTOM_DISABLE_PD1,
+      CUSTOM_DISABLE_CM55, CUSTOM_DEEPSLEEP_OFF, WORKLOAD_CM33_SPECS,
+      WORKLOAD_CM55_SPECS, CUSTOM_GATING, CUSTOM_SRAM_RETENTION },
+#endif
+};
+
+#define POWER_PROFILE_COUNT \
+    (sizeof(power_profiles) / sizeof(power_profiles[0]))
+
+/*******************************************************************************
+* Function Name: power_profile_count
+********************************************************************************
+* Summary:
+* Returns the number of profiles in the table.
+*
+*******************************************************************************/
+uint32_t power_profile_count(void)
+{
+    return POWER_PROFILE_COUNT;
+}
+
+/*******************************************************************************
+* Function Name: power_profile_get
+********************************************************************************
+* Summary:
+* Returns the profile at the given table index, or NULL.
+*
+*******************************************************************************/
+const power_profile_t *power_profile_get(uint32_t index)
+{
+    return (index < POWER_PROFILE_COUNT) ? &power_profiles[index] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: power_profile_find
+********************************************************************************
+* Summary:
+* Returns the profile of a SPEC ID. CUSTOM is only in the table when it is the
+* SPEC_ID the application is built with.
+*
+* Parameters:
+*  spec_id: One of the SPEC ID constants of specs.h
+*
+* Return:
+*  const power_profile_t *: The profile, or NULL for an unknown SPEC ID
+*
+*******************************************************************************/
+const power_profile_t *power_profile_find(uint32_t spec_id)
+{
+    uint32_t index;
+
+    for (index = 0U; index < POWER_PROFILE_COUNT; index++)
+    {
+        if (power_profiles[index].spec_id == spec_id)
+        {
+            return &power_profiles[index];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: power_profile_deep_sleep_mode
+********************************************************************************
+* Summary:
+* Returns the system Deep Sleep mode of a profile. Profiles with PD1 off use
+* Deep Sleep-OFF, unless they retain part of the SRAM.
+*
+* Parameters:
+*  profile: Profile
+*
+* Return:
+*  cy_en_syspm_deep_sleep_mode_t: CY_SYSPM_MODE_DEEPSLEEP or
+*                                 CY_SYSPM_MODE_DEEPSLEEP_OFF
+*
+*******************************************************************************/
+cy_en_syspm_deep_sleep_mode_t power_profile_deep_sleep_mode(
+    const power_profile_t *profile)
+{
+    return (profile->disable_pd1 && (NULL == profile->sram_retention)) ?
+        CY_SYSPM_MODE_DEEPSLEEP_OFF : CY_SYSPM_MODE_DEEPSLEEP;
+}
+
+/*******************************************************************************
+* Function Name: power_profile_marker_code
+********************************************************************************
+* Summary:
+* Returns the marker code of the phase in which a profile is applied: its
+* marker_code, or its SPEC ID for the profiles of the table.
+*
+* Parameters:
+*  profile: Profile
+*
+* Return:
+*  uint32_t: Code sent on the marker code pin
+*
+*******************************************************************************/
+uint32_t power_profile_marker_code(const power_profile_t *profile)
+{
+    return (0U != profile->marker_code) ? profile->marker_code :
+                                          profile->spec_id;
+}
+
+/*******************************************************************************
+* Function Name: power_profile_post
+********************************************************************************
+* Summary:
+* Leaves the profile in the IPC mailbox for the next boot of the CM55 and
+* clears the ready mailbox. The IPC registers are outside PD1 and keep their
+* value while the CM55 is off.
+*
+* Parameters:
+*  profile: Profile the CM55 applies when it boots
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_profile_post(const power_profile_t *profile)
+{
+    IPC_STRUCT_Type *mailbox =
+        Cy_IPC_Drv_GetIpcBaseAddress(POWER_PROFILE_IPC_CHAN);
+
+    Cy_IPC_Drv_WriteDataValue(
+        Cy_IPC_Drv_GetIpcBaseAddress(POWER_PROFILE_READY_CHAN), 0U);
+    Cy_IPC_Drv_WriteDataValue(mailbox,
+                              POWER_PROFILE_MAILBOX_MAGIC | profile->spec_id);
+}
+
+/*******************************************************************************
+* Function Name: power_profile_received
+********************************************************************************
+* Summary:
+* Returns the profile posted by the CM33, or the profile of the compiled
+* SPEC_ID when the mailbox holds none.
+*
+*******************************************************************************/
+const power_profile_t *power_profile_received(void)
+{
+    uint32_t value = Cy_IPC_Drv_ReadDataValue(
+                        Cy_IPC_Drv_GetIpcBaseAddress(POWER_PROFILE_IPC_CHAN));
+    const power_profile_t *profile = NULL;
+
+    if (POWER_PROFILE_MAILBOX_MAGIC == (value & POWER_PROFILE_MAILBOX_MASK))
+    {
+        profile = power_profile_find(value & ~POWER_PROFILE_MAILBOX_MASK);
+    }
+
+    return (NULL != profile) ? profile : power_profile_find(SPEC_ID);
+}
+
+/*******************************************************************************
+* Function Name: power_profile_signal_ready
+********************************************************************************
+* Summary:
+* Tells the CM33 that the CM55 has applied its part of a profile: clocks,
+* power domains and workload.
+*
+* Parameters:
+*  profile: Profile applied, as returned by power_profile_received()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_profile_signal_ready(const power_profile_t *profile)
+{
+    Cy_IPC_Drv_WriteDataValue(
+        Cy_IPC_Drv_GetIpcBaseAddress(POWER_PROFILE_READY_CHAN),
+        POWER_PROFILE_READY_MAGIC | profile->spec_id);
+}
+
+/*******************************************************************************
+* Function Name: power_profile_wait_ready
+********************************************************************************
+* Summary:
+* Waits until the CM55 signals that it has applied a profile.
+*
+* Parameters:
+*  profile: Profile posted with power_profile_post()
+*  timeout_us: Longest wait in microseconds
+*
+* Return:
+*  bool: true when the CM55 signalled, false on timeout
+*
+*******************************************************************************/
+bool power_profile_wait_ready(const power_profile_t *profile,
+                              uint32_t timeout_us)
+{
+    const IPC_STRUCT_Type *mailbox =
+        Cy_IPC_Drv_GetIpcBaseAddress(POWER_PROFILE_READY_CHAN);
+    const uint32_t ready = POWER_PROFILE_READY_MAGIC | profile->spec_id;
+    uint32_t waited_us = 0U;
+
+    while (Cy_IPC_Drv_ReadDataValue(mailbox) != ready)
+    {
+        if (waited_us >= timeout_us)
+        {
+            return false;
+        }
+        Cy_SysLib_DelayUs(POWER_PROFILE_READY_POLL_US);
+        waited_us += POWER_PROFILE_READY_POLL_US;
+    }
+
+    return true;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* File Name        : ring.c
+*
+* Description      : This file implements the single-producer,
+*                    single-consumer ring buffer between the CPUs. The CM55
+*                    caches the shared SRAM, so it cleans what it writes and
+*                    invalidates what it reads; the CM33 has no data cache.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define RING_INDEX_MASK             (RING_SLOTS - 1U)
+
+#if defined(COMPONENT_CM55) && !defined(HOST_BUILD) && \
+    defined(__DCACHE_PRESENT) && (1U == __DCACHE_PRESENT)
+#define RING_CLEAN(addr)            SCB_CleanDCache_by_Addr((void *)(addr), \
+                                        (int32_t)RING_CACHE_LINE)
+#define RING_INVALIDATE(addr)       SCB_InvalidateDCache_by_Addr( \
+                                        (void *)(addr), \
+                                        (int32_t)RING_CACHE_LINE)
+#else
+#define RING_CLEAN(addr)            __DMB()
+#define RING_INVALIDATE(addr)       __DMB()
+#endif
+
+/*******************************************************************************
+* Function Name: ring_init
+********************************************************************************
+* Summary:
+* Empties a ring. Only call it while neither CPU uses the ring.
+*
+* Parameters:
+*  ring: Ring in shared SRAM
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void ring_init(ring_t *ring)
+{
+    ring->head = 0U;
+    RING_CLEAN(&ring->head);
+    ring->tail = 0U;
+    RING_CLEAN(&ring->tail);
+}
+
+/*******************************************************************************
+* Function Name: ring_push
+********************************************************************************
+* Summary:
+* Copies a message into the next free slot and publishes it by advancing the
+* head. Only the producer of the ring may call it.
+*
+* Parameters:
+*  ring: Ring in shared SRAM
+*  msg: Message to send
+*
+* Return:
+*  bool: false when the ring is full
+*
+*******************************************************************************/
+bool ring_push(ring_t *ring, const ring_msg_t *msg)
+{
+    uint32_t head = ring->head;
+    ring_msg_t *slot;
+
+    RING_INVALIDATE(&ring->tail);
+    if ((head - ring->tail) >= RING_SLOTS)
+    {
+        return false;
+    }
+
+    slot = &ring->slots[head & RING_INDEX_MASK];
+    (void)memcpy(slot, msg, sizeof(*slot));
+
+    /* The message must reach the SRAM before the new head */
+    RING_CLEAN(slot);
+    ring->head = head + 1U;
+    RING_CLEAN(&ring->head);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ring_pop
+********************************************************************************
+* Summary:
+* Copies the oldest message out of the ring and frees its slot by advancing
+* the tail. Only the consumer of the ring may call it.
+*
+* Parameters:
+*  ring: Ring in shared SRAM
+*  msg: Received message
+*
+* Return:
+*  bool: false when the ring is empty
+*
+*******************************************************************************/
+bool ring_pop(ring_t *ring, ring_msg_t *msg)
+{
+    uint32_t tail = ring->tail;
+    ring_msg_t *slot;
+
+    RING_INVALIDATE(&ring->head);
+    if (ring->head == tail)
+    {
+        return false;
+    }
+
+    /* Read the slot only after the head that published it */
+    slot = &ring->slots[tail & RING_INDEX_MASK];
+    RING_INVALIDATE(slot);
+    (void)memcpy(msg, slot, sizeof(*msg));
+
+    /* The slot must be read before it is handed back to the producer */
+    __DMB();
+    ring->tail = tail + 1U;
+    RING_CLEAN(&ring->tail);
+
+    return true;
+}
+
+/* [] END OF FILE */
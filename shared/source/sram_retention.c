@@ -0,0 +1,191 @@
+/*******************************************************************************
+* File Name        : sram_retention.c
+*
+* Description      : This file powers the SRAM macros of the CM33 up and down
+*                    for the retention of a power profile.
+*
+* Related Document : See README.md
+*
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "sram_retention.h"
+#include "specs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SRAM_RETENTION_SIZE         (SRAM_RETENTION_SRAMS * \
+                                     SRAM_RETENTION_MACROS * \
+                                     SRAM_RETENTION_MACRO_SIZE)
+
+/* Memory that the images may use: the linker maps, or everything */
+#if defined(SRAM_MAP_POWER_DOWN)
+#define USED_MEMORY                 (&sram_retention_used)
+#else
+#define USED_MEMORY                 (NULL)
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+sram_retention_t sram_retention_siddsa =
+{
+    .retained = { SIDDSA_SRAM0_RETAINED, SIDDSA_SRAM1_RETAINED },
+    .socmem_retained = SRAM_RETENTION_ALL_PARTITIONS
+};
+
+/*******************************************************************************
+* Function Name: mark_in_use
+********************************************************************************
+* Summary:
+* Sets the bit of the macro that holds an address in a per-SRAM mask, if the
+* address is in the SRAM.
+*
+*******************************************************************************/
+static void mark_in_use(uintptr_t address, uint32_t *in_use)
+{
+    uint32_t macro;
+
+    address &= ~(uintptr_t)SRAM_RETENTION_SECURE_ALIAS;
+    if ((address < SRAM_RETENTION_BASE) ||
+        ((address - SRAM_RETENTION_BASE) >= SRAM_RETENTION_SIZE))
+    {
+        return;
+    }
+
+    macro = (uint32_t)((address - SRAM_RETENTION_BASE) /
+                       SRAM_RETENTION_MACRO_SIZE);
+    in_use[macro / SRAM_RETENTION_MACROS] |=
+        1UL << (macro % SRAM_RETENTION_MACROS);
+}
+
+/*******************************************************************************
+* Function Name: retained_macros
+********************************************************************************
+* Summary:
+* Returns the macros of an SRAM that a retention keeps; NULL keeps all.
+*
+*******************************************************************************/
+static uint32_t retained_macros(const sram_retention_t *retention,
+                                uint32_t sram)
+{
+    return (NULL != retention) ? retention->retained[sram] :
+                                 SRAM_RETENTION_ALL_MACROS;
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_apply
+********************************************************************************
+* Summary:
+* Powers up the retained SRAM macros and powers down the others. Retained
+* macros stay powered in Deep Sleep; the content of the others is lost. With
+* SRAM_MAP_POWER_DOWN, the macros that no image uses stay powered down in any
+* case. The macros of the stack and data of the calling CPU and of the memory
+* shared with the CM55 must be retained, otherwise nothing is changed.
+*
+* Parameters:
+*  retention: Macros to retain, or NULL for all macros
+*
+* Return:
+*  bool: false if the retention would power down a macro in use
+*
+*******************************************************************************/
+bool sram_retention_apply(const sram_retention_t *retention)
+{
+    uint32_t in_use[SRAM_RETENTION_SRAMS] = { 0U };
+    uint32_t retained[SRAM_RETENTION_SRAMS];
+    uint32_t sram;
+    uint32_t macro;
+
+    mark_in_use((uintptr_t)&in_use, in_use);
+    mark_in_use((uintptr_t)&sram_retention_siddsa, in_use);
+    mark_in_use((uintptr_t)CYMEM_CM33_0_m33_m55_shared_START, in_use);
+
+    for (sram = 0U; sram < SRAM_RETENTION_SRAMS; sram++)
+    {
+        retained[sram] = retained_macros(retention, sram) &
+                         retained_macros(USED_MEMORY, sram);
+        if (0U != (in_use[sram] & ~retained[sram]))
+        {
+            return false;
+        }
+    }
+
+    for (sram = 0U; sram < SRAM_RETENTION_SRAMS; sram++)
+    {
+        for (macro = 0U; macro < SRAM_RETENTION_MACROS; macro++)
+        {
+            (void)Cy_SysPm_SetSRAMMacroPwrMode(
+                (cy_en_syspm_sram_index_t)sram, macro,
+                (0U != (retained[sram] & (1UL << macro))) ?
+                CY_SYSPM_SRAM_PWR_MODE_ON : CY_SYSPM_SRAM_PWR_MODE_OFF);
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_socmem_apply
+********************************************************************************
+* Summary:
+* Powers down the SOCMEM partitions that no image uses, when
+* SRAM_MAP_POWER_DOWN is defined and SOCMEM is kept enabled. The partitions
+* are in PD1, which powers them up again whenever it turns on, so call it
+* with PD1 on before each boot of the CM55.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sram_retention_socmem_apply(void)
+{
+#if defined(SRAM_MAP_POWER_DOWN) && defined(KEEP_SOCMEM)
+    uint32_t partition;
+
+    for (partition = 0U; partition < SRAM_RETENTION_SOCMEM_PARTITIONS;
+         partition++)
+    {
+        if (0U == (sram_retention_used.socmem_retained & (1UL << partition)))
+        {
+            (void)Cy_SysPm_SetSOCMEMSramPartitionPwrMode(partition,
+                CY_SYSPM_SOCMEM_SRAM_ACTIVE_MODE, CY_SYSPM_SOCMEM_SRAM_OFF);
+        }
+    }
+#endif
+}
+
+/* [] END OF FILE */
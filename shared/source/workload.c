@@ -0,0 +1,352 @@
+/*******************************************************************************
+* File Name        : workload.c
+*
+* Description      : This file implements the workload registry and the
+*                    built-in workloads shared by the CM33 and CM55 CPUs.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+* (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+* Technologies AG. All rights reserved.
+* This software, associated documentation and materials ("Software") is
+* owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+* and is protected by and subject to worldwide patent protection, worldwide
+* copyright laws, and international treaty provisions. Therefore, you may use
+* this Software only as provided in the license agreement accompanying the
+* software package from which you obtained this Software. If no license
+* agreement applies, then any use, reproduction, modification, translation, or
+* compilation of this Software is prohibited without the express written
+* permission of Infineon.
+*
+* Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+* IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+* INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+* THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+* SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+* Infineon reserves the right to make changes to the Software without notice.
+* You are responsible for properly designing, programming, and testing the
+* functionality and safety of your intended application of the Software, as
+* well as complying with any legal requirements related to its use. Infineon
+* does not guarantee that the Software will be free from intrusion, data theft
+* or loss, or other breaches ("Security Breaches"), and Infineon shall have
+* no liability arising out of any Security Breaches. Unless otherwise
+* explicitly approved by Infineon, the Software may not be used in any
+* application where a failure of the Product or any consequences of the use
+* thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "cybsp.h"
+#include "dhry.h"
+#include "dhry_prof.h"
+#include "workload.h"
+#include "event_trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DEEP_SLEEP_OFF_TOKEN        (0xB1)
+
+/* Free-running Dhrystone iterations executed per super-loop step */
+#define DHRY_STEP_RUNS              (1000U)
+
+
+/* High-frequency clock which drives the calling CPU */
+#if defined(COMPONENT_CM55)
+#define CPU_CLK_HF                  (CY_CFG_SYSCLK_CLKHF1)
+#else
+#define CPU_CLK_HF                  (CY_CFG_SYSCLK_CLKHF0)
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void sleep_run(void);
+static void deep_sleep_run(void);
+static void while_loop_run(void);
+static void dhrystone_select(void);
+static void dhrystone_step(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if defined(DHRY_ITERATIONS)
+/* Score of the last bounded Dhrystone batch. Read it with the debugger. */
+dhry_score_t dhry_score;
+#endif
+
+volatile uint32_t workload_request = WORKLOAD_NONE;
+
+static const workload_t builtin_workloads[] =
+{
+    { "sleep",      NULL, sleep_run,      NULL },
+    { "deep_sleep", NULL, deep_sleep_run, NULL },
+    { "while_loop", NULL, while_loop_run, NULL },
+    { "dhrystone",  dhrystone_select, dhrystone_step, NULL },
+};
+
+#define BUILTIN_WORKLOAD_COUNT \
+    (sizeof(builtin_workloads) / sizeof(builtin_workloads[0]))
+
+static const workload_t *registry[WORKLOAD_MAX] =
+{
+    &builtin_workloads[0],
+    &builtin_workloads[1],
+    &builtin_workloads[2],
+    &builtin_workloads[3],
+};
+
+static uint32_t registry_count = BUILTIN_WORKLOAD_COUNT;
+static const workload_t *current_workload = NULL;
+
+/*******************************************************************************
+* Function Name: sleep_run
+********************************************************************************
+* Summary:
+* Puts the CPU in Sleep until the next interrupt.
+*
+*******************************************************************************/
+static void sleep_run(void)
+{
+    EVENT_TRACE(EVENT_TRACE_SLEEP_ENTER, 0U);
+    Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+    EVENT_TRACE(EVENT_TRACE_SLEEP_EXIT, 0U);
+}
+
+/*******************************************************************************
+* Function Name: deep_sleep_run
+********************************************************************************
+* Summary:
+* Puts the CPU in Deep Sleep until the next interrupt. The CM55 writes the
+* Deep Sleep-OFF token first so that its domain may be turned off.
+*
+*******************************************************************************/
+static void deep_sleep_run(void)
+{
+#if defined(COMPONENT_CM55)
+    SRSS_PWR_HIBERNATE = (SRSS_PWR_HIBERNATE  | DEEP_SLEEP_OFF_TOKEN);
+#endif
+    EVENT_TRACE(EVENT_TRACE_DEEP_SLEEP_ENTER, 0U);
+    Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+    EVENT_TRACE(EVENT_TRACE_DEEP_SLEEP_EXIT, 0U);
+}
+
+/*******************************************************************************
+* Function Name: while_loop_run
+********************************************************************************
+* Summary:
+* Keeps the CPU active. The super-loop calls it back-to-back.
+*
+*******************************************************************************/
+static void while_loop_run(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: dhrystone_select
+********************************************************************************
+* Summary:
+* Initializes the Dhrystone records once per selection, so that the steps
+* only run iterations. The profiler starts with empty histograms.
+*
+*******************************************************************************/
+static void dhrystone_select(void)
+{
+    dhrystone_init();
+#if defined(DHRY_PROFILE)
+    dhry_prof_reset();
+#endif
+}
+
+/*******************************************************************************
+* Function Name: dhrystone_step
+********************************************************************************
+* Summary:
+* Runs one scored batch of DHRY_ITERATIONS when that option is set, otherwise
+* a short free-running batch counted in dhry_run_count.
+*
+*******************************************************************************/
+static void dhrystone_step(void)
+{
+#if defined(DHRY_ITERATIONS)
+    dhrystone_measure(DHRY_ITERATIONS,
+        Cy_SysClk_ClkHfGetFrequency(CPU_CLK_HF), &dhry_score);
+#else
+    dhrystone_run(DHRY_STEP_RUNS);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: workload_register
+********************************************************************************
+* Summary:
+* Adds a workload to the registry of the calling CPU. The workload must stay
+* valid for the lifetime of the application. Registering the same workload
+* again has no effect; a full registry or a duplicate name is an application
+* error.
+*
+* Parameters:
+*  workload: Workload to add
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void workload_register(const workload_t *workload)
+{
+    if ((NULL != workload) && (workload_find(workload->name) == workload))
+    {
+        return;
+    }
+
+    if ((NULL == workload) || (NULL == workload->name) ||
+        (NULL == workload->run) || (registry_count >= WORKLOAD_MAX) ||
+        (NULL != workload_find(workload->name)))
+    {
+        handle_app_error();
+    }
+
+    registry[registry_count] = workload;
+    registry_count++;
+}
+
+/*******************************************************************************
+* Function Name: workload_count
+********************************************************************************
+* Summary:
+* Returns the number of registered workloads.
+*
+*******************************************************************************/
+uint32_t workload_count(void)
+{
+    return registry_count;
+}
+
+/*******************************************************************************
+* Function Name: workload_get
+********************************************************************************
+* Summary:
+* Returns the registered workload at the given index, or NULL.
+*
+*******************************************************************************/
+const workload_t *workload_get(uint32_t index)
+{
+    return (index < registry_count) ? registry[index] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: workload_find
+********************************************************************************
+* Summary:
+* Returns the registered workload with the given name, or NULL. A NULL name
+* matches no workload.
+*
+*******************************************************************************/
+const workload_t *workload_find(const char *name)
+{
+    uint32_t index;
+
+    if (NULL == name)
+    {
+        return NULL;
+    }
+
+    for (index = 0U; index < registry_count; index++)
+    {
+        if (0 == strcmp(registry[index]->name, name))
+        {
+            return registry[index];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: workload_current
+********************************************************************************
+* Summary:
+* Returns the selected workload, or NULL before the first selection.
+*
+*******************************************************************************/
+const workload_t *workload_current(void)
+{
+    return current_workload;
+}
+
+/*******************************************************************************
+* Function Name: workload_select
+********************************************************************************
+* Summary:
+* Switches to the named workload. The teardown hook of the previous workload
+* runs before the init hook of the new one.
+*
+* Parameters:
+*  name: Name of a registered workload
+*
+* Return:
+*  bool: false if name is NULL or no workload has that name; the selection
+*        is then unchanged
+*
+*******************************************************************************/
+bool workload_select(const char *name)
+{
+    const workload_t *workload = workload_find(name);
+
+    if (NULL == workload)
+    {
+        return false;
+    }
+
+    if ((NULL != current_workload) && (NULL != current_workload->teardown))
+    {
+        current_workload->teardown();
+    }
+
+    current_workload = workload;
+
+    if (NULL != workload->init)
+    {
+        workload->init();
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: workload_step
+********************************************************************************
+* Summary:
+* Applies a pending workload_request and runs one step of the selected
+* workload. The CPU super-loops call it forever.
+*
+*******************************************************************************/
+void workload_step(void)
+{
+    uint32_t request = workload_request;
+
+    if (WORKLOAD_NONE != request)
+    {
+        workload_request = WORKLOAD_NONE;
+        if (request < registry_count)
+        {
+            (void)workload_select(registry[request]->name);
+        }
+    }
+
+    if (NULL == current_workload)
+    {
+        if (!workload_select(WORKLOAD_DEFAULT))
+        {
+            handle_app_error();
+        }
+    }
+
+    current_workload->run();
+}
+
+/* [] END OF FILE */